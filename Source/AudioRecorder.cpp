@@ -12,18 +12,20 @@ AudioRecorder::~AudioRecorder()
         stopRecording();
 }
 
-void AudioRecorder::startRecording(double sampleRate)
+void AudioRecorder::startRecording(double sampleRate, int outputLatency)
 {
     if (recording)
         return;
         
     currentSampleRate = sampleRate;
     bufferWritePosition = 0;
+    outputLatencySamples = juce::jlimit(0, maxRecordingLength, outputLatency);
     recordBuffer.clear();
     currentFileName = generateFileName();
     recording = true;
     
-    juce::Logger::writeToLog("Recording started: " + currentFileName);
+    juce::Logger::writeToLog("Recording started: " + currentFileName
+                             + " (output aligned by " + juce::String(outputLatencySamples) + " samples)");
 }
 
 void AudioRecorder::stopRecording()
@@ -37,19 +39,26 @@ void AudioRecorder::stopRecording()
     juce::Logger::writeToLog("Recording stopped: " + currentFileName);
 }
 
-void AudioRecorder::addSamples(float leftSample, float rightSample)
+void AudioRecorder::addSamples(float inputSample, float outputSample)
 {
     if (!recording || bufferWritePosition >= maxRecordingLength)
         return;
         
-    recordBuffer.setSample(0, bufferWritePosition, leftSample);   // Left channel (input)
-    recordBuffer.setSample(1, bufferWritePosition, rightSample); // Right channel (effect output)
+    recordBuffer.setSample(0, bufferWritePosition, inputSample); // Left channel (input)
+
+    // Right channel (effect output), written where the input that produced it sits
+    const int outputPosition = bufferWritePosition - outputLatencySamples;
+    if (outputPosition >= 0)
+        recordBuffer.setSample(1, outputPosition, outputSample);
+
     bufferWritePosition++;
 }
 
 void AudioRecorder::writeWavFile()
 {
-    if (bufferWritePosition == 0)
+    // The last outputLatencySamples of input have no output yet
+    const int alignedSamples = bufferWritePosition - outputLatencySamples;
+    if (alignedSamples <= 0)
         return;
         
     // Get the executable directory
@@ -81,7 +90,7 @@ void AudioRecorder::writeWavFile()
     if (writer != nullptr)
     {
         // Write the recorded audio data
-        writer->writeFromAudioSampleBuffer(recordBuffer, 0, bufferWritePosition);
+        writer->writeFromAudioSampleBuffer(recordBuffer, 0, alignedSamples);
         writer.reset(); // This will close the file
         
         juce::Logger::writeToLog("WAV file saved: " + outputFile.getFullPathName());
@@ -8,11 +8,12 @@ public:
     AudioRecorder();
     ~AudioRecorder();
     
-    void startRecording(double sampleRate);
+    // The output lags the input by outputLatency samples; it is stored against the input that produced it
+    void startRecording(double sampleRate, int outputLatency = 0);
     void stopRecording();
     bool isRecording() const { return recording; }
     
-    void addSamples(float leftSample, float rightSample);
+    void addSamples(float inputSample, float outputSample);
     
 private:
     void writeWavFile();
@@ -22,6 +23,7 @@ private:
     double currentSampleRate = 44100.0;
     juce::AudioBuffer<float> recordBuffer;
     int bufferWritePosition = 0;
+    int outputLatencySamples = 0;
     juce::String currentFileName;
     
     static const int maxRecordingLength = 44100 * 60 * 10; // 10 minutes at 44.1kHz
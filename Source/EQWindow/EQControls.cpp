@@ -277,6 +277,11 @@ LimiterSection::LimiterSection(const juce::String& title)
     ratioText.setAccessible(false);
     atText.setAccessible(false);
     rtText.setAccessible(false);
+    oversamplingCombo.setAccessible(false);
+    windowCombo.setAccessible(false);
+    linkCombo.setAccessible(false);
+    lookaheadCombo.setAccessible(false);
+    meterLabel.setAccessible(false);
     
     titleLabel.setText(title, juce::dontSendNotification);
     titleLabel.setColour(juce::Label::textColourId, juce::Colour(0xffff6b35));
@@ -294,6 +299,7 @@ LimiterSection::LimiterSection(const juce::String& title)
     ratioLabel.setColour(juce::Label::textColourId, juce::Colour(0xffff6b35));
     atLabel.setColour(juce::Label::textColourId, juce::Colour(0xffff6b35));
     rtLabel.setColour(juce::Label::textColourId, juce::Colour(0xffff6b35));
+    meterLabel.setColour(juce::Label::textColourId, juce::Colour(0xffff6b35));
     
     thSlider.setSliderStyle(juce::Slider::LinearHorizontal);
     ratioSlider.setSliderStyle(juce::Slider::LinearHorizontal);
@@ -336,6 +342,84 @@ LimiterSection::LimiterSection(const juce::String& title)
     ratioText.setColour(juce::TextEditor::textColourId, juce::Colour(0xffff6b35));
     atText.setColour(juce::TextEditor::textColourId, juce::Colour(0xffff6b35));
     rtText.setColour(juce::TextEditor::textColourId, juce::Colour(0xffff6b35));
+    
+    oversamplingCombo.addItem("1x", 1);
+    oversamplingCombo.addItem("2x", 2);
+    oversamplingCombo.addItem("4x", 3);
+    oversamplingCombo.addItem("8x", 4);
+    oversamplingCombo.setSelectedId(1, juce::dontSendNotification);
+    oversamplingCombo.setTooltip("Oversampling");
+
+    for (int windowMs : { 5, 10, 20, 50, 100 })
+        windowCombo.addItem(juce::String(windowMs) + "ms", windowMs);
+    windowCombo.setSelectedId(10, juce::dontSendNotification);
+    windowCombo.setTooltip("RMS window");
+
+    for (int step = 0; step <= 4; ++step)
+        linkCombo.addItem(juce::String(step * 25) + "%", step + 1);
+    linkCombo.setSelectedId(5, juce::dontSendNotification);
+    linkCombo.setTooltip("Stereo link");
+
+    for (int tenths : { 5, 10, 20, 50 })
+        lookaheadCombo.addItem(juce::String(tenths / 10.0f, tenths % 10 == 0 ? 0 : 1) + "ms", tenths);
+    lookaheadCombo.setSelectedId(10, juce::dontSendNotification);
+    lookaheadCombo.setTooltip("Lookahead");
+}
+
+LimiterMeter::LimiterMeter()
+{
+    setInterceptsMouseClicks(false, false);
+}
+
+void LimiterMeter::setLevels(float peakDb, float rmsDb, float gainReductionDb)
+{
+    const float newPeak = juce::jmax(peakDb, peak - 1.0f, -100.0f);
+    const float newRMS = juce::jmax(rmsDb, -100.0f);
+    const float newGainReduction = juce::jmax(0.0f, gainReductionDb, gainReduction - 1.0f);
+
+    if (newPeak == peak && newRMS == rms && newGainReduction == gainReduction)
+        return;
+
+    peak = newPeak;
+    rms = newRMS;
+    gainReduction = newGainReduction;
+    repaint();
+}
+
+void LimiterMeter::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+    auto reductionArea = bounds.removeFromRight(bounds.getWidth() * 0.3f);
+    bounds.removeFromRight(6.0f);
+
+    g.setColour(juce::Colour(0xff2a2a2a));
+    g.fillRect(bounds);
+    g.fillRect(reductionArea);
+
+    const auto levelToX = [&bounds](float db)
+    {
+        return bounds.getX() + bounds.getWidth() * juce::jlimit(0.0f, 1.0f, (db + 60.0f) / 60.0f);
+    };
+
+    g.setColour(juce::Colour(0xff6bb6ff));
+    g.fillRect(bounds.withRight(levelToX(rms)));
+
+    g.setColour(peak > -1.0f ? juce::Colours::red : juce::Colour(0xffff8c00));
+    g.fillRect(juce::Rectangle<float>(levelToX(peak) - 1.0f, bounds.getY(), 2.0f, bounds.getHeight()));
+
+    const float reductionWidth = reductionArea.getWidth() * juce::jlimit(0.0f, 1.0f, gainReduction / 24.0f);
+    g.setColour(juce::Colour(0xffff6b35));
+    g.fillRect(reductionArea.withLeft(reductionArea.getRight() - reductionWidth));
+
+    g.setColour(juce::Colours::white);
+    g.setFont(11.0f);
+    g.drawText(peak > -100.0f ? juce::String(peak, 1) + " dB" : juce::String("-inf"),
+               bounds.reduced(4.0f, 0.0f), juce::Justification::centredRight);
+    g.drawText("GR " + juce::String(gainReduction, 1), reductionArea, juce::Justification::centred);
+
+    g.setColour(juce::Colour(0xff4a4a4a));
+    g.drawRect(bounds, 1.0f);
+    g.drawRect(reductionArea, 1.0f);
 }
 
 LimiterSection::~LimiterSection()
@@ -53,6 +53,25 @@ struct EQBand
     void setupCallbacks();
 };
 
+// Level and gain reduction of one limiter stage. The level bar fills to the RMS with a line at the peak,
+// over -60 to 0 dBFS; the gain reduction bar grows leftwards from the right edge, over 0 to 24 dB.
+class LimiterMeter : public juce::Component
+{
+public:
+    LimiterMeter();
+
+    // In dB, as LimiterProcessor::MeterReadings has them; call at the window's timer rate.
+    // Peaks and gain reduction fall back 1 dB per call, so short peaks stay visible.
+    void setLevels(float peakDb, float rmsDb, float gainReductionDb);
+
+    void paint(juce::Graphics& g) override;
+
+private:
+    float peak = -100.0f;
+    float rms = -100.0f;
+    float gainReduction = 0.0f;
+};
+
 // Limiter Section control structure
 struct LimiterSection
 {
@@ -70,6 +89,12 @@ struct LimiterSection
     juce::TextEditor ratioText;
     juce::TextEditor atText;
     juce::TextEditor rtText;
+    juce::ComboBox oversamplingCombo; // Shown in the peak section only; item id - 1 = order
+    juce::ComboBox windowCombo;       // Shown in the RMS section only; item id = detector window in ms
+    juce::ComboBox linkCombo;         // Stereo link in 25% steps; item id - 1 = link / 25
+    juce::ComboBox lookaheadCombo;    // Shown in the peak section only; item id = lookahead in tenths of a ms
+    juce::Label meterLabel;
+    LimiterMeter meter;               // Input level in the RMS section, output level in the peak section
     
     explicit LimiterSection(const juce::String& title);
     ~LimiterSection();
@@ -4,12 +4,18 @@
 #include "../EffectJUCE/LimiterProcessor.h"
 #include "../Utils.h"
 
+static_assert(EQWindow::MAX_BANDS == IIRFilterProcessor::maxBands, "One set of band controls per processor band");
+
 // EQWindow Implementation
 EQWindow::EQWindow(IIRFilterProcessor* processor)
-    : DocumentWindow("7-Band Parametric EQ", juce::Colours::black, DocumentWindow::closeButton),
+    : DocumentWindow(juce::String(DEFAULT_NUM_BANDS) + "-Band Parametric EQ", juce::Colours::black, DocumentWindow::closeButton),
       eqProcessor(processor)
 {
     setUsingNativeTitleBar(true);
+
+    // Both channels start from the band controls' defaults
+    for (int i = 0; i < MAX_BANDS; ++i)
+        channelBands[0][i] = channelBands[1][i] = getDefaultBandSettings(i);
     
     // Create content component
     content = std::make_unique<EQContent>(this);
@@ -199,8 +205,54 @@ void EQWindow::sliderValueChanged(juce::Slider* slider)
     }
 }
 
-void EQWindow::comboBoxChanged(juce::ComboBox* /*comboBox*/)
+void EQWindow::comboBoxChanged(juce::ComboBox* comboBox)
 {
+    if (content && content->peakLimiter
+        && (comboBox == &content->peakLimiter->oversamplingCombo || comboBox == &content->peakLimiter->lookaheadCombo))
+    {
+        updateLimiterProcessor();
+        if (limiterProcessor)
+        {
+            const auto& peakParams = limiterProcessor->getPeakParams();
+            const juce::String setting = comboBox == &content->peakLimiter->oversamplingCombo ? "oversampling" : "lookahead";
+            juce::Logger::writeToLog("Peak limiter " + setting + " changed to: " + comboBox->getText()
+                                     + " (latency " + juce::String(limiterProcessor->getLatencySamples(peakParams.oversamplingOrder, peakParams.lookahead)) + " samples)");
+        }
+        return;
+    }
+
+    if (content && content->rmsLimiter && content->peakLimiter
+        && (comboBox == &content->rmsLimiter->linkCombo || comboBox == &content->peakLimiter->linkCombo))
+    {
+        updateLimiterProcessor();
+        juce::Logger::writeToLog("Limiter stereo link changed to: " + comboBox->getText());
+        return;
+    }
+
+    if (content && content->rmsLimiter && comboBox == &content->rmsLimiter->windowCombo)
+    {
+        updateLimiterProcessor();
+        juce::Logger::writeToLog("RMS limiter window changed to: " + comboBox->getText());
+        return;
+    }
+
+    if (content && comboBox == &content->stereoModeCombo)
+    {
+        updateStereoMode();
+        juce::Logger::writeToLog("EQ stereo mode changed to: " + comboBox->getText());
+    }
+    else if (content && comboBox == &content->bandCountCombo)
+    {
+        setNumBands(comboBox->getSelectedId());
+        juce::Logger::writeToLog("EQ band count changed to: " + juce::String(numBands));
+    }
+    else if (content && comboBox == &content->editChannelCombo)
+    {
+        // Show the other channel's curve; the controls are written back below unchanged
+        editedChannel = comboBox->getSelectedId() - 1;
+        showBandSettings(editedChannel);
+    }
+
     updateEQProcessor();
     
     if (content && content->frequencyDisplay)
@@ -232,6 +284,15 @@ void EQWindow::buttonClicked(juce::Button* button)
         resetParamsToDefaults();
         return;
     }
+
+    if (button == &content->linearPhaseButton)
+    {
+        updatePhaseMode();
+        if (eqProcessor)
+            juce::Logger::writeToLog("EQ phase mode changed to: " + juce::String(button->getToggleState() ? "linear" : "minimum")
+                                     + " (latency " + juce::String(eqProcessor->getLatencySamples()) + " samples)");
+        return;
+    }
     
     // For all other buttons (Enable/Disable)
     updateEQProcessor();
@@ -247,21 +308,31 @@ void EQWindow::buttonClicked(juce::Button* button)
 void EQWindow::timerCallback()
 {
     updateDisplay();
+    updateLimiterMeters();
 }
 
 void EQWindow::updateEQProcessor()
 {
     if (!eqProcessor || !content)
         return;
+
+    const bool linked = isStereoLinked();
     
-    for (int i = 0; i < content->eqBands.size() && i < 7; ++i)
+    for (int i = 0; i < content->eqBands.size() && i < numBands; ++i)
     {
         auto* band = content->eqBands[i];
-        bool enabled = band->enableButton.getToggleState();
-        juce::String type = band->typeCombo.getText();
-        float freq = static_cast<float>(band->freqSlider.getValue());
-        float gain = static_cast<float>(band->gainSlider.getValue());
-        float q = static_cast<float>(band->qSlider.getValue());
+        BandSettings settings;
+        settings.enabled = band->enableButton.getToggleState();
+        settings.type = band->typeCombo.getText();
+        settings.freq = band->freqSlider.getValue();
+        settings.gain = band->gainSlider.getValue();
+        settings.q = band->qSlider.getValue();
+
+        channelBands[editedChannel][i] = settings;
+        if (linked)
+            channelBands[1 - editedChannel][i] = settings;
+
+        const bool enabled = settings.enabled;
         
         // Enable/disable controls based on enable button
         band->typeCombo.setEnabled(enabled);
@@ -271,17 +342,97 @@ void EQWindow::updateEQProcessor()
         band->freqText.setEnabled(enabled);
         band->gainText.setEnabled(enabled);
         band->qText.setEnabled(enabled);
-        
-        if (enabled)
+    }
+
+    // Each processor gets its own channel's curve
+    IIRFilterProcessor* processors[2] = { eqProcessor, secondEqProcessor };
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        if (processors[channel] == nullptr)
+            continue;
+
+        processors[channel]->setNumBands(numBands);
+        for (int i = 0; i < numBands; ++i)
         {
-            eqProcessor->updateBand(i, type, freq, gain, q);
-            if (secondEqProcessor) secondEqProcessor->updateBand(i, type, freq, gain, q);
+            const auto& settings = channelBands[channel][i];
+
+            // Disabled bands bypass, filters included, and drop out of the processing cascade
+            const auto type = settings.enabled ? IIRFilterProcessor::filterTypeFromName(settings.type)
+                                               : IIRFilterProcessor::FilterType::Bypass;
+            processors[channel]->updateBand(i, type, static_cast<float>(settings.freq),
+                                            static_cast<float>(settings.gain), static_cast<float>(settings.q));
         }
-        else
+    }
+}
+
+void EQWindow::updatePhaseMode()
+{
+    if (!content)
+        return;
+
+    const auto mode = content->linearPhaseButton.getToggleState() ? IIRFilterProcessor::PhaseMode::LinearPhase
+                                                                  : IIRFilterProcessor::PhaseMode::MinimumPhase;
+    if (eqProcessor) eqProcessor->setPhaseMode(mode);
+    if (secondEqProcessor) secondEqProcessor->setPhaseMode(mode);
+}
+
+bool EQWindow::isStereoLinked() const
+{
+    return content == nullptr || content->stereoModeCombo.getSelectedId() == 1;
+}
+
+void EQWindow::updateStereoMode()
+{
+    if (!content)
+        return;
+
+    const bool linked = isStereoLinked();
+    const bool midSide = content->stereoModeCombo.getSelectedId() == 3;
+
+    // Linking copies the curve being edited to the other channel
+    if (linked)
+        for (int i = 0; i < MAX_BANDS; ++i)
+            channelBands[1 - editedChannel][i] = channelBands[editedChannel][i];
+
+    auto& editChannelCombo = content->editChannelCombo;
+    editChannelCombo.changeItemText(1, midSide ? "Mid" : "Left");
+    editChannelCombo.changeItemText(2, midSide ? "Side" : "Right");
+    editChannelCombo.setSelectedId(editedChannel + 1, juce::dontSendNotification); // Refreshes the shown text
+    editChannelCombo.setEnabled(!linked);
+
+    const auto mode = midSide ? IIRFilterProcessor::StereoMode::MidSide : IIRFilterProcessor::StereoMode::LeftRight;
+    if (eqProcessor) eqProcessor->setStereoMode(mode);
+    if (secondEqProcessor) secondEqProcessor->setStereoMode(mode);
+}
+
+void EQWindow::showBandSettings(int channel)
+{
+    if (!content)
+        return;
+
+    for (int i = 0; i < content->eqBands.size() && i < MAX_BANDS; ++i)
+    {
+        auto* band = content->eqBands[i];
+        const auto& settings = channelBands[channel][i];
+
+        band->enableButton.setToggleState(settings.enabled, juce::dontSendNotification);
+
+        for (int j = 1; j <= band->typeCombo.getNumItems(); ++j)
         {
-            eqProcessor->updateBand(i, type, freq, 0.0f, q);
-            if (secondEqProcessor) secondEqProcessor->updateBand(i, type, freq, 0.0f, q);
+            if (band->typeCombo.getItemText(j - 1) == settings.type)
+            {
+                band->typeCombo.setSelectedId(j, juce::dontSendNotification);
+                break;
+            }
         }
+
+        band->freqSlider.setValue(settings.freq, juce::dontSendNotification);
+        band->gainSlider.setValue(settings.gain, juce::dontSendNotification);
+        band->qSlider.setValue(settings.q, juce::dontSendNotification);
+
+        band->freqText.setText(juce::String(static_cast<int>(settings.freq)), juce::dontSendNotification);
+        band->gainText.setText(juce::String(settings.gain, 1), juce::dontSendNotification);
+        band->qText.setText(juce::String(settings.q, 2), juce::dontSendNotification);
     }
 }
 
@@ -297,6 +448,8 @@ void EQWindow::updateLimiterProcessor()
     rmsParams.attack = static_cast<float>(content->rmsLimiter->atSlider.getValue());
     rmsParams.release = static_cast<float>(content->rmsLimiter->rtSlider.getValue());
     rmsParams.enabled = content->rmsLimiter->enableButton.getToggleState();
+    rmsParams.window = static_cast<float>(content->rmsLimiter->windowCombo.getSelectedId());
+    rmsParams.link = static_cast<float>((content->rmsLimiter->linkCombo.getSelectedId() - 1) * 25);
     
     // Get Peak limiter parameters from UI
     LimiterProcessor::LimiterParams peakParams;
@@ -305,12 +458,26 @@ void EQWindow::updateLimiterProcessor()
     peakParams.attack = static_cast<float>(content->peakLimiter->atSlider.getValue());
     peakParams.release = static_cast<float>(content->peakLimiter->rtSlider.getValue());
     peakParams.enabled = content->peakLimiter->enableButton.getToggleState();
+    peakParams.oversamplingOrder = content->peakLimiter->oversamplingCombo.getSelectedId() - 1;
+    peakParams.link = static_cast<float>((content->peakLimiter->linkCombo.getSelectedId() - 1) * 25);
+    peakParams.lookahead = static_cast<float>(content->peakLimiter->lookaheadCombo.getSelectedId()) / 10.0f;
     
     // Update the limiter processor with new parameters
     limiterProcessor->setRMSParams(rmsParams);
     limiterProcessor->setPeakParams(peakParams);
 }
 
+void EQWindow::updateLimiterMeters()
+{
+    if (!limiterProcessor || !content || !content->rmsLimiter || !content->peakLimiter)
+        return;
+
+    // The signal enters through the RMS stage and leaves through the peak stage
+    const auto readings = limiterProcessor->takeMeterReadings();
+    content->rmsLimiter->meter.setLevels(readings.inputPeak, readings.inputRMS, readings.rmsGainReduction);
+    content->peakLimiter->meter.setLevels(readings.outputPeak, readings.outputRMS, readings.peakGainReduction);
+}
+
 void EQWindow::updateDisplay()
 {
     if (content && content->frequencyDisplay)
@@ -327,21 +494,31 @@ void EQWindow::saveLimiterParams()
     // Create JSON object
     juce::var jsonData = juce::var(new juce::DynamicObject());
     
-    // Save EQ parameters
+    // Save EQ parameters: the left (or mid) curve as band1..bandN, the right (or side) one under "secondChannel"
     juce::var eqData = juce::var(new juce::DynamicObject());
-    for (int i = 0; i < content->eqBands.size() && i < 7; ++i)
+    juce::var secondChannelData = juce::var(new juce::DynamicObject());
+    for (int channel = 0; channel < 2; ++channel)
     {
-        auto* band = content->eqBands[i];
-        juce::var bandData = juce::var(new juce::DynamicObject());
-        
-        bandData.getDynamicObject()->setProperty("enabled", band->enableButton.getToggleState());
-        bandData.getDynamicObject()->setProperty("type", band->typeCombo.getText());
-        bandData.getDynamicObject()->setProperty("frequency", band->freqSlider.getValue());
-        bandData.getDynamicObject()->setProperty("gain", band->gainSlider.getValue());
-        bandData.getDynamicObject()->setProperty("q", band->qSlider.getValue());
-        
-        eqData.getDynamicObject()->setProperty("band" + juce::String(i + 1), bandData);
+        auto& channelData = channel == 0 ? eqData : secondChannelData;
+
+        for (int i = 0; i < numBands; ++i)
+        {
+            const auto& settings = channelBands[channel][i];
+            juce::var bandData = juce::var(new juce::DynamicObject());
+            
+            bandData.getDynamicObject()->setProperty("enabled", settings.enabled);
+            bandData.getDynamicObject()->setProperty("type", settings.type);
+            bandData.getDynamicObject()->setProperty("frequency", settings.freq);
+            bandData.getDynamicObject()->setProperty("gain", settings.gain);
+            bandData.getDynamicObject()->setProperty("q", settings.q);
+            
+            channelData.getDynamicObject()->setProperty("band" + juce::String(i + 1), bandData);
+        }
     }
+    eqData.getDynamicObject()->setProperty("numBands", numBands);
+    eqData.getDynamicObject()->setProperty("secondChannel", secondChannelData);
+    eqData.getDynamicObject()->setProperty("stereoMode", content->stereoModeCombo.getSelectedId() - 1);
+    eqData.getDynamicObject()->setProperty("linearPhase", content->linearPhaseButton.getToggleState());
     jsonData.getDynamicObject()->setProperty("eq", eqData);
     
     // Get current parameters
@@ -355,6 +532,8 @@ void EQWindow::saveLimiterParams()
     rmsData.getDynamicObject()->setProperty("attack", rmsParams.attack);
     rmsData.getDynamicObject()->setProperty("release", rmsParams.release);
     rmsData.getDynamicObject()->setProperty("enabled", rmsParams.enabled);
+    rmsData.getDynamicObject()->setProperty("window", rmsParams.window);
+    rmsData.getDynamicObject()->setProperty("link", rmsParams.link);
     
     // Save Peak limiter parameters
     juce::var peakData = juce::var(new juce::DynamicObject());
@@ -363,6 +542,9 @@ void EQWindow::saveLimiterParams()
     peakData.getDynamicObject()->setProperty("attack", peakParams.attack);
     peakData.getDynamicObject()->setProperty("release", peakParams.release);
     peakData.getDynamicObject()->setProperty("enabled", peakParams.enabled);
+    peakData.getDynamicObject()->setProperty("oversampling", peakParams.oversamplingOrder);
+    peakData.getDynamicObject()->setProperty("link", peakParams.link);
+    peakData.getDynamicObject()->setProperty("lookahead", peakParams.lookahead);
     
     jsonData.getDynamicObject()->setProperty("rmsLimiter", rmsData);
     jsonData.getDynamicObject()->setProperty("peakLimiter", peakData);
@@ -417,43 +599,45 @@ void EQWindow::loadLimiterParams()
         juce::var eqData = jsonData["eq"];
         if (eqData.isObject())
         {
-            for (int i = 0; i < content->eqBands.size() && i < 7; ++i)
+            // Files without a second channel load the same curve into both; files without a band count have 7 bands
+            juce::var secondChannelData = eqData.getProperty("secondChannel", eqData);
+            const int bandCount = juce::jlimit(1, MAX_BANDS, static_cast<int>(eqData.getProperty("numBands", DEFAULT_NUM_BANDS)));
+
+            for (int channel = 0; channel < 2; ++channel)
             {
-                juce::String bandKey = "band" + juce::String(i + 1);
-                if (eqData.hasProperty(bandKey.toRawUTF8()))
+                const auto& channelData = channel == 0 ? eqData : secondChannelData;
+
+                for (int i = 0; i < MAX_BANDS; ++i)
                 {
-                    juce::var bandData = eqData[bandKey.toRawUTF8()];
-                    if (bandData.isObject())
+                    // Bands past the file's count go back to their defaults
+                    channelBands[channel][i] = getDefaultBandSettings(i);
+
+                    juce::String bandKey = "band" + juce::String(i + 1);
+                    if (i < bandCount && channelData.hasProperty(bandKey.toRawUTF8()))
                     {
-                        auto* band = content->eqBands[i];
-                        
-                        bool enabled = bandData.getProperty("enabled", true);
-                        juce::String type = bandData.getProperty("type", "PEQ").toString();
-                        double freq = bandData.getProperty("frequency", 1000.0);
-                        double gain = bandData.getProperty("gain", 0.0);
-                        double q = bandData.getProperty("q", 0.7);
-                        
-                        band->enableButton.setToggleState(enabled, juce::dontSendNotification);
-                        
-                        for (int j = 1; j <= band->typeCombo.getNumItems(); ++j)
+                        juce::var bandData = channelData[bandKey.toRawUTF8()];
+                        if (bandData.isObject())
                         {
-                            if (band->typeCombo.getItemText(j - 1) == type)
-                            {
-                                band->typeCombo.setSelectedId(j, juce::dontSendNotification);
-                                break;
-                            }
+                            auto& settings = channelBands[channel][i];
+                            settings.enabled = bandData.getProperty("enabled", true);
+                            settings.type = bandData.getProperty("type", "PEQ").toString();
+                            settings.freq = bandData.getProperty("frequency", 1000.0);
+                            settings.gain = bandData.getProperty("gain", 0.0);
+                            settings.q = bandData.getProperty("q", 0.7);
                         }
-                        
-                        band->freqSlider.setValue(freq, juce::dontSendNotification);
-                        band->gainSlider.setValue(gain, juce::dontSendNotification);
-                        band->qSlider.setValue(q, juce::dontSendNotification);
-                        
-                        band->freqText.setText(juce::String(static_cast<int>(freq)), juce::dontSendNotification);
-                        band->gainText.setText(juce::String(gain, 1), juce::dontSendNotification);
-                        band->qText.setText(juce::String(q, 2), juce::dontSendNotification);
                     }
                 }
             }
+
+            const int stereoMode = juce::jlimit(0, 2, static_cast<int>(eqData.getProperty("stereoMode", 0)));
+            content->stereoModeCombo.setSelectedId(stereoMode + 1, juce::dontSendNotification);
+            editedChannel = 0;
+            updateStereoMode();
+            setNumBands(bandCount);
+            showBandSettings(editedChannel);
+
+            content->linearPhaseButton.setToggleState(eqData.getProperty("linearPhase", false), juce::dontSendNotification);
+            updatePhaseMode();
         }
         updateEQProcessor();
     }
@@ -470,6 +654,8 @@ void EQWindow::loadLimiterParams()
             rmsParams.attack = rmsData.getProperty("attack", 50.0f);
             rmsParams.release = rmsData.getProperty("release", 200.0f);
             rmsParams.enabled = rmsData.getProperty("enabled", false);
+            rmsParams.window = rmsData.getProperty("window", 10.0f);
+            rmsParams.link = rmsData.getProperty("link", 100.0f);
             
             limiterProcessor->setRMSParams(rmsParams);
             
@@ -478,6 +664,8 @@ void EQWindow::loadLimiterParams()
             content->rmsLimiter->atSlider.setValue(rmsParams.attack, juce::dontSendNotification);
             content->rmsLimiter->rtSlider.setValue(rmsParams.release, juce::dontSendNotification);
             content->rmsLimiter->enableButton.setToggleState(rmsParams.enabled, juce::dontSendNotification);
+            content->rmsLimiter->windowCombo.setSelectedId(juce::roundToInt(rmsParams.window), juce::dontSendNotification);
+            content->rmsLimiter->linkCombo.setSelectedId(juce::roundToInt(rmsParams.link / 25.0f) + 1, juce::dontSendNotification);
             
             content->rmsLimiter->thText.setText(juce::String(rmsParams.threshold, 1), juce::dontSendNotification);
             content->rmsLimiter->ratioText.setText(juce::String(rmsParams.ratio, 1), juce::dontSendNotification);
@@ -498,6 +686,10 @@ void EQWindow::loadLimiterParams()
             peakParams.attack = peakData.getProperty("attack", 50.0f);
             peakParams.release = peakData.getProperty("release", 200.0f);
             peakParams.enabled = peakData.getProperty("enabled", false);
+            peakParams.oversamplingOrder = juce::jlimit(0, LimiterProcessor::maxOversamplingOrder,
+                                                        static_cast<int>(peakData.getProperty("oversampling", 0)));
+            peakParams.link = peakData.getProperty("link", 100.0f);
+            peakParams.lookahead = peakData.getProperty("lookahead", 1.0f);
             
             limiterProcessor->setPeakParams(peakParams);
             
@@ -506,6 +698,9 @@ void EQWindow::loadLimiterParams()
             content->peakLimiter->atSlider.setValue(peakParams.attack, juce::dontSendNotification);
             content->peakLimiter->rtSlider.setValue(peakParams.release, juce::dontSendNotification);
             content->peakLimiter->enableButton.setToggleState(peakParams.enabled, juce::dontSendNotification);
+            content->peakLimiter->oversamplingCombo.setSelectedId(peakParams.oversamplingOrder + 1, juce::dontSendNotification);
+            content->peakLimiter->linkCombo.setSelectedId(juce::roundToInt(peakParams.link / 25.0f) + 1, juce::dontSendNotification);
+            content->peakLimiter->lookaheadCombo.setSelectedId(juce::roundToInt(peakParams.lookahead * 10.0f), juce::dontSendNotification);
             
             content->peakLimiter->thText.setText(juce::String(peakParams.threshold, 1), juce::dontSendNotification);
             content->peakLimiter->ratioText.setText(juce::String(peakParams.ratio, 1), juce::dontSendNotification);
@@ -528,33 +723,72 @@ void EQWindow::loadLimiterParams()
                                          "Parameters loaded successfully");
 }
 
+void EQWindow::applyAutoEQ(const std::vector<AutoEQFitter::Band>& bands)
+{
+    if (!content)
+        return;
+
+    const int bandCount = juce::jlimit(1, MAX_BANDS, static_cast<int>(bands.size()));
+
+    for (int i = 0; i < MAX_BANDS; ++i)
+    {
+        auto& settings = channelBands[0][i];
+        settings = getDefaultBandSettings(i);
+
+        if (i >= bandCount)
+            continue;
+
+        if (i < static_cast<int>(bands.size()) && bands[(size_t) i].type != IIRFilterProcessor::FilterType::Bypass)
+        {
+            const auto& band = bands[(size_t) i];
+            settings.type = IIRFilterProcessor::getFilterTypeName(band.type);
+            settings.freq = band.frequency;
+            settings.gain = band.gain;
+            settings.q = band.q;
+        }
+        else
+        {
+            settings.enabled = false; // Not needed by the fit
+        }
+    }
+
+    content->stereoModeCombo.setSelectedId(1, juce::dontSendNotification);
+    editedChannel = 0;
+    updateStereoMode();
+    setNumBands(bandCount);
+    showBandSettings(editedChannel);
+    updateEQProcessor();
+    updateDisplay();
+
+    if (content->frequencyDisplay)
+        content->frequencyDisplay->repaint();
+}
+
 void EQWindow::resetParamsToDefaults()
 {
     if (!content)
         return;
-        
-    juce::Array<float> defaultFreqs = {100.0f, 200.0f, 400.0f, 800.0f, 1600.0f, 3200.0f, 6400.0f};
+
+    // Back to one curve for both channels
+    content->stereoModeCombo.setSelectedId(1, juce::dontSendNotification);
+    editedChannel = 0;
+    updateStereoMode();
     
     // Reset EQ bands
-    for (int i = 0; i < content->eqBands.size() && i < 7; ++i)
-    {
-        auto* band = content->eqBands[i];
-        
-        band->enableButton.setToggleState(true, juce::dontSendNotification);
-        band->typeCombo.setSelectedId(1, juce::dontSendNotification);
-        band->freqSlider.setValue(defaultFreqs[i], juce::dontSendNotification);
-        band->gainSlider.setValue(0.0, juce::dontSendNotification);
-        band->qSlider.setValue(0.7, juce::dontSendNotification);
-        
-        band->freqText.setText(juce::String(static_cast<int>(defaultFreqs[i])), juce::dontSendNotification);
-        band->gainText.setText("0.0", juce::dontSendNotification);
-        band->qText.setText("0.70", juce::dontSendNotification);
-    }
+    for (int i = 0; i < MAX_BANDS; ++i)
+        channelBands[0][i] = channelBands[1][i] = getDefaultBandSettings(i);
+    setNumBands(DEFAULT_NUM_BANDS);
+    showBandSettings(editedChannel);
     
+    content->linearPhaseButton.setToggleState(false, juce::dontSendNotification);
+    updatePhaseMode();
+
     // Reset RMS Limiter
     if (content->rmsLimiter)
     {
         content->rmsLimiter->enableButton.setToggleState(false, juce::dontSendNotification);
+        content->rmsLimiter->windowCombo.setSelectedId(10, juce::dontSendNotification);
+        content->rmsLimiter->linkCombo.setSelectedId(5, juce::dontSendNotification);
         content->rmsLimiter->thSlider.setValue(0.0, juce::dontSendNotification);
         content->rmsLimiter->ratioSlider.setValue(10.0, juce::dontSendNotification);
         content->rmsLimiter->atSlider.setValue(50.0, juce::dontSendNotification);
@@ -570,6 +804,9 @@ void EQWindow::resetParamsToDefaults()
     if (content->peakLimiter)
     {
         content->peakLimiter->enableButton.setToggleState(false, juce::dontSendNotification);
+        content->peakLimiter->oversamplingCombo.setSelectedId(1, juce::dontSendNotification);
+        content->peakLimiter->linkCombo.setSelectedId(5, juce::dontSendNotification);
+        content->peakLimiter->lookaheadCombo.setSelectedId(10, juce::dontSendNotification);
         content->peakLimiter->thSlider.setValue(0.0, juce::dontSendNotification);
         content->peakLimiter->ratioSlider.setValue(10.0, juce::dontSendNotification);
         content->peakLimiter->atSlider.setValue(50.0, juce::dontSendNotification);
@@ -590,6 +827,29 @@ void EQWindow::resetParamsToDefaults()
     }
 }
 
+EQWindow::BandSettings EQWindow::getDefaultBandSettings(int band)
+{
+    BandSettings settings;
+    if (band < DEFAULT_NUM_BANDS)
+        settings.freq = 100.0 * static_cast<double>(1 << band);
+    else
+        settings.freq = 20.0 * std::pow(1000.0, (band - DEFAULT_NUM_BANDS + 0.5) / (MAX_BANDS - DEFAULT_NUM_BANDS));
+    settings.freq = std::round(settings.freq);
+    return settings;
+}
+
+void EQWindow::setNumBands(int newNumBands)
+{
+    numBands = juce::jlimit(1, MAX_BANDS, newNumBands);
+    setName(juce::String(numBands) + "-Band Parametric EQ");
+
+    if (content)
+    {
+        content->bandCountCombo.setSelectedId(numBands, juce::dontSendNotification);
+        content->resized(); // Shows the bands in use
+    }
+}
+
 // EQContent Implementation
 EQWindow::EQContent::EQContent(EQWindow* parent)
     : parentWindow(parent)
@@ -641,6 +901,8 @@ EQWindow::EQContent::~EQContent()
         if (rmsLimiter)
         {
             rmsLimiter->enableButton.removeListener(parentWindow);
+            rmsLimiter->windowCombo.removeListener(parentWindow);
+            rmsLimiter->linkCombo.removeListener(parentWindow);
             rmsLimiter->thSlider.removeListener(parentWindow);
             rmsLimiter->ratioSlider.removeListener(parentWindow);
             rmsLimiter->atSlider.removeListener(parentWindow);
@@ -650,6 +912,9 @@ EQWindow::EQContent::~EQContent()
         if (peakLimiter)
         {
             peakLimiter->enableButton.removeListener(parentWindow);
+            peakLimiter->oversamplingCombo.removeListener(parentWindow);
+            peakLimiter->linkCombo.removeListener(parentWindow);
+            peakLimiter->lookaheadCombo.removeListener(parentWindow);
             peakLimiter->thSlider.removeListener(parentWindow);
             peakLimiter->ratioSlider.removeListener(parentWindow);
             peakLimiter->atSlider.removeListener(parentWindow);
@@ -659,6 +924,10 @@ EQWindow::EQContent::~EQContent()
         loadButton.removeListener(parentWindow);
         saveButton.removeListener(parentWindow);
         resetButton.removeListener(parentWindow);
+        linearPhaseButton.removeListener(parentWindow);
+        stereoModeCombo.removeListener(parentWindow);
+        editChannelCombo.removeListener(parentWindow);
+        bandCountCombo.removeListener(parentWindow);
     }
     
     // Reset look and feel for all components
@@ -728,16 +997,19 @@ void EQWindow::EQContent::resized()
     loadButton.setBounds(15, 8, buttonWidth, buttonHeight);
     saveButton.setBounds(15 + buttonWidth + buttonSpacing, 8, buttonWidth, buttonHeight);
     resetButton.setBounds(15 + (buttonWidth + buttonSpacing) * 2, 8, buttonWidth, buttonHeight);
+    linearPhaseButton.setBounds(15 + (buttonWidth + buttonSpacing) * 3, 8, 120, buttonHeight);
+    stereoModeCombo.setBounds(15 + (buttonWidth + buttonSpacing) * 3 + 120 + buttonSpacing, 8, 120, buttonHeight);
+    editChannelCombo.setBounds(15 + (buttonWidth + buttonSpacing) * 3 + (120 + buttonSpacing) * 2, 8, buttonWidth, buttonHeight);
+    bandCountCombo.setBounds(15 + (buttonWidth + buttonSpacing) * 4 + (120 + buttonSpacing) * 2, 8, 100, buttonHeight);
 
     // Frequency display
     auto displayArea = bounds.removeFromTop(350);
     frequencyDisplay->setBounds(displayArea.reduced(10));
     
-    // EQ bands area
-    auto bandsArea = bounds.removeFromTop(300);
+    // EQ bands area, with room under the controls for the scroll bar
+    auto bandsArea = bounds.removeFromTop(320);
     bandsArea = bandsArea.reduced(10);
-    int availableWidth = bandsArea.getWidth() - 70 - 20;
-    int bandWidth = availableWidth / 7;
+    const int scrollBarThickness = 10;
     
     // First band labels
     if (eqBands.size() > 0)
@@ -750,21 +1022,30 @@ void EQWindow::EQContent::resized()
         firstBand->gainLabel.setBounds(labelX, labelY + 150, 60, 20);
         firstBand->qLabel.setBounds(labelX, labelY + 210, 40, 20);
     }
+
+    // Bands in use share the width down to a minimum, then scroll
+    const int numBands = parentWindow != nullptr ? parentWindow->getNumBands() : DEFAULT_NUM_BANDS;
+    const int availableWidth = bandsArea.getWidth() - 70 - 20;
+    const int bandWidth = juce::jmax(110, availableWidth / numBands);
+    const bool scrolling = bandWidth * numBands > availableWidth;
+
+    bandsViewport.setBounds(bandsArea.getX() + 70, bandsArea.getY(), availableWidth + 20, 295 + scrollBarThickness);
+    bandsViewport.setScrollBarsShown(false, scrolling);
+    bandsContainer.setSize(juce::jmax(bandWidth * numBands, availableWidth), 295);
     
     // Position all bands
     for (int i = 0; i < eqBands.size(); ++i)
     {
         auto* band = eqBands[i];
-        int x = bandsArea.getX() + 70 + i * bandWidth;
-        int y = bandsArea.getY();
-        
-        if (i > 0)
-        {
-            band->typeLabel.setVisible(false);
-            band->freqLabel.setVisible(false);
-            band->gainLabel.setVisible(false);
-            band->qLabel.setVisible(false);
-        }
+        int x = i * bandWidth;
+        int y = 0;
+
+        const bool inUse = i < numBands;
+        for (auto* control : std::initializer_list<juce::Component*> { &band->enableButton, &band->typeCombo,
+                                                                       &band->freqSlider, &band->freqText,
+                                                                       &band->gainSlider, &band->gainText,
+                                                                       &band->qSlider, &band->qText })
+            control->setVisible(inUse);
         
         band->enableButton.setBounds(x, y, bandWidth - 10, 25);
         band->typeCombo.setBounds(x, y + 30, bandWidth - 10, 25);
@@ -787,6 +1068,8 @@ void EQWindow::EQContent::resized()
         
         rmsLimiter->titleLabel.setBounds(rmsArea.getX(), rmsArea.getY(), rmsArea.getWidth(), 20);
         rmsLimiter->enableButton.setBounds(rmsArea.getX() + rmsArea.getWidth() - 80, rmsArea.getY(), 70, 20);
+        rmsLimiter->windowCombo.setBounds(rmsArea.getX() + rmsArea.getWidth() - 150, rmsArea.getY(), 60, 20);
+        rmsLimiter->linkCombo.setBounds(rmsArea.getX() + rmsArea.getWidth() - 220, rmsArea.getY(), 65, 20);
         
         int yPos = rmsArea.getY() + 25;
         int rowHeight = 25;
@@ -811,6 +1094,10 @@ void EQWindow::EQContent::resized()
         rmsLimiter->rtLabel.setBounds(rmsArea.getX(), yPos, 80, rowHeight);
         rmsLimiter->rtSlider.setBounds(rmsArea.getX() + 85, yPos, sliderWidth, rowHeight);
         rmsLimiter->rtText.setBounds(rmsArea.getX() + rmsArea.getWidth() - textWidth, yPos, textWidth, rowHeight);
+        
+        yPos += rowHeight + 5;
+        rmsLimiter->meterLabel.setBounds(rmsArea.getX(), yPos, 80, rowHeight);
+        rmsLimiter->meter.setBounds(rmsArea.getX() + 85, yPos + 3, rmsArea.getWidth() - 85, rowHeight - 6);
     }
     
     // Peak Limiter (right)
@@ -821,6 +1108,9 @@ void EQWindow::EQContent::resized()
         
         peakLimiter->titleLabel.setBounds(peakArea.getX(), peakArea.getY(), peakArea.getWidth(), 20);
         peakLimiter->enableButton.setBounds(peakArea.getX() + peakArea.getWidth() - 80, peakArea.getY(), 70, 20);
+        peakLimiter->oversamplingCombo.setBounds(peakArea.getX() + peakArea.getWidth() - 150, peakArea.getY(), 60, 20);
+        peakLimiter->linkCombo.setBounds(peakArea.getX() + peakArea.getWidth() - 220, peakArea.getY(), 65, 20);
+        peakLimiter->lookaheadCombo.setBounds(peakArea.getX() + peakArea.getWidth() - 290, peakArea.getY(), 65, 20);
         
         int yPos = peakArea.getY() + 25;
         int rowHeight = 25;
@@ -845,6 +1135,10 @@ void EQWindow::EQContent::resized()
         peakLimiter->rtLabel.setBounds(peakArea.getX(), yPos, 80, rowHeight);
         peakLimiter->rtSlider.setBounds(peakArea.getX() + 85, yPos, sliderWidth, rowHeight);
         peakLimiter->rtText.setBounds(peakArea.getX() + peakArea.getWidth() - textWidth, yPos, textWidth, rowHeight);
+        
+        yPos += rowHeight + 5;
+        peakLimiter->meterLabel.setBounds(peakArea.getX(), yPos, 80, rowHeight);
+        peakLimiter->meter.setBounds(peakArea.getX() + 85, yPos + 3, peakArea.getWidth() - 85, rowHeight - 6);
     }
 }
 
@@ -854,10 +1148,17 @@ void EQWindow::EQContent::setupEQBands()
     auto& customLookAndFeel = CustomSliderLookAndFeel::getInstance();
     
     juce::StringArray filterTypes = {"PEQ", "LSH", "HSH", "LPF", "HPF"};
-    juce::Array<float> defaultFreqs = {100.0f, 200.0f, 400.0f, 800.0f, 1600.0f, 3200.0f, 6400.0f};
+
+    bandsViewport.setViewedComponent(&bandsContainer, false);
+    bandsViewport.setScrollBarThickness(10);
+    bandsViewport.getHorizontalScrollBar().setColour(juce::ScrollBar::backgroundColourId, juce::Colour(0xff2a2a2a));
+    bandsViewport.getHorizontalScrollBar().setColour(juce::ScrollBar::thumbColourId, juce::Colour(0xff6bb6ff));
+    addAndMakeVisible(bandsViewport);
     
-    for (int i = 0; i < 7; ++i)
+    for (int i = 0; i < MAX_BANDS; ++i)
     {
+        // The window sets up the channels' default bands before its content
+        const double defaultFreq = parentWindow->channelBands[0][i].freq;
         auto* band = new EQBand();
         
         band->enableButton.setButtonText("Enable");
@@ -869,7 +1170,7 @@ void EQWindow::EQContent::setupEQBands()
         
         band->freqSlider.setRange(20.0, 20000.0, 1.0);
         band->freqSlider.setSkewFactorFromMidPoint(1000.0);
-        band->freqSlider.setValue(defaultFreqs[i]);
+        band->freqSlider.setValue(defaultFreq);
         band->freqSlider.addListener(parentWindow);
         
         band->gainSlider.setRange(-12.0, 12.0, 0.1);
@@ -880,7 +1181,7 @@ void EQWindow::EQContent::setupEQBands()
         band->qSlider.setValue(0.7);
         band->qSlider.addListener(parentWindow);
         
-        band->freqText.setText(juce::String(static_cast<int>(defaultFreqs[i])), false);
+        band->freqText.setText(juce::String(static_cast<int>(defaultFreq)), false);
         band->gainText.setText("0.0", false);
         band->qText.setText("0.70", false);
         
@@ -894,19 +1195,22 @@ void EQWindow::EQContent::setupEQBands()
         band->gainText.setLookAndFeel(&customLookAndFeel);
         band->qText.setLookAndFeel(&customLookAndFeel);
         
-        // Make visible
-        addAndMakeVisible(band->enableButton);
-        addAndMakeVisible(band->typeLabel);
-        addAndMakeVisible(band->freqLabel);
-        addAndMakeVisible(band->gainLabel);
-        addAndMakeVisible(band->qLabel);
-        addAndMakeVisible(band->typeCombo);
-        addAndMakeVisible(band->freqSlider);
-        addAndMakeVisible(band->gainSlider);
-        addAndMakeVisible(band->qSlider);
-        addAndMakeVisible(band->freqText);
-        addAndMakeVisible(band->gainText);
-        addAndMakeVisible(band->qText);
+        // Make visible; the row labels are shown once, left of the scrolling controls
+        if (i == 0)
+        {
+            addAndMakeVisible(band->typeLabel);
+            addAndMakeVisible(band->freqLabel);
+            addAndMakeVisible(band->gainLabel);
+            addAndMakeVisible(band->qLabel);
+        }
+        bandsContainer.addAndMakeVisible(band->enableButton);
+        bandsContainer.addAndMakeVisible(band->typeCombo);
+        bandsContainer.addAndMakeVisible(band->freqSlider);
+        bandsContainer.addAndMakeVisible(band->gainSlider);
+        bandsContainer.addAndMakeVisible(band->qSlider);
+        bandsContainer.addAndMakeVisible(band->freqText);
+        bandsContainer.addAndMakeVisible(band->gainText);
+        bandsContainer.addAndMakeVisible(band->qText);
         
         eqBands.add(band);
     }
@@ -920,6 +1224,7 @@ void EQWindow::EQContent::setupLimiters()
     // RMS Limiter
     rmsLimiter = std::make_unique<LimiterSection>("RMS Limiter:");
     rmsLimiter->setupCallbacks();
+    rmsLimiter->meterLabel.setText("Input", juce::dontSendNotification);
     
     // Apply custom look and feel - Use singleton
     rmsLimiter->thSlider.setLookAndFeel(&customLookAndFeel);
@@ -934,6 +1239,8 @@ void EQWindow::EQContent::setupLimiters()
     // Add components
     addAndMakeVisible(rmsLimiter->titleLabel);
     addAndMakeVisible(rmsLimiter->enableButton);
+    addAndMakeVisible(rmsLimiter->windowCombo);
+    addAndMakeVisible(rmsLimiter->linkCombo);
     addAndMakeVisible(rmsLimiter->thLabel);
     addAndMakeVisible(rmsLimiter->ratioLabel);
     addAndMakeVisible(rmsLimiter->atLabel);
@@ -946,9 +1253,13 @@ void EQWindow::EQContent::setupLimiters()
     addAndMakeVisible(rmsLimiter->ratioText);
     addAndMakeVisible(rmsLimiter->atText);
     addAndMakeVisible(rmsLimiter->rtText);
+    addAndMakeVisible(rmsLimiter->meterLabel);
+    addAndMakeVisible(rmsLimiter->meter);
     
     // Add listeners
     rmsLimiter->enableButton.addListener(parentWindow);
+    rmsLimiter->windowCombo.addListener(parentWindow);
+    rmsLimiter->linkCombo.addListener(parentWindow);
     rmsLimiter->thSlider.addListener(parentWindow);
     rmsLimiter->ratioSlider.addListener(parentWindow);
     rmsLimiter->atSlider.addListener(parentWindow);
@@ -958,6 +1269,14 @@ void EQWindow::EQContent::setupLimiters()
     peakLimiter = std::make_unique<LimiterSection>("Peak Limiter:");
     peakLimiter->setLinearSliders();
     peakLimiter->setupCallbacks();
+
+    peakLimiter->meterLabel.setText("Output", juce::dontSendNotification);
+
+    // The peak limiter's attack is its lookahead, and as a brickwall it has no ratio
+    peakLimiter->atSlider.setEnabled(false);
+    peakLimiter->atText.setEnabled(false);
+    peakLimiter->ratioSlider.setEnabled(false);
+    peakLimiter->ratioText.setEnabled(false);
     
     // Apply custom look and feel - Use singleton
     peakLimiter->thSlider.setLookAndFeel(&customLookAndFeel);
@@ -972,6 +1291,9 @@ void EQWindow::EQContent::setupLimiters()
     // Add components
     addAndMakeVisible(peakLimiter->titleLabel);
     addAndMakeVisible(peakLimiter->enableButton);
+    addAndMakeVisible(peakLimiter->oversamplingCombo);
+    addAndMakeVisible(peakLimiter->linkCombo);
+    addAndMakeVisible(peakLimiter->lookaheadCombo);
     addAndMakeVisible(peakLimiter->thLabel);
     addAndMakeVisible(peakLimiter->ratioLabel);
     addAndMakeVisible(peakLimiter->atLabel);
@@ -984,9 +1306,14 @@ void EQWindow::EQContent::setupLimiters()
     addAndMakeVisible(peakLimiter->ratioText);
     addAndMakeVisible(peakLimiter->atText);
     addAndMakeVisible(peakLimiter->rtText);
+    addAndMakeVisible(peakLimiter->meterLabel);
+    addAndMakeVisible(peakLimiter->meter);
     
     // Add listeners
     peakLimiter->enableButton.addListener(parentWindow);
+    peakLimiter->oversamplingCombo.addListener(parentWindow);
+    peakLimiter->linkCombo.addListener(parentWindow);
+    peakLimiter->lookaheadCombo.addListener(parentWindow);
     peakLimiter->thSlider.addListener(parentWindow);
     peakLimiter->ratioSlider.addListener(parentWindow);
     peakLimiter->atSlider.addListener(parentWindow);
@@ -998,12 +1325,36 @@ void EQWindow::EQContent::setupButtons()
     loadButton.setButtonText("Load");
     saveButton.setButtonText("Save");
     resetButton.setButtonText("Reset");
+    linearPhaseButton.setButtonText("Linear Phase");
+
+    // Linked keeps one curve for both channels; the others give each channel its own
+    stereoModeCombo.addItem("Linked", 1);
+    stereoModeCombo.addItem("Left / Right", 2);
+    stereoModeCombo.addItem("Mid / Side", 3);
+    stereoModeCombo.setSelectedId(1, juce::dontSendNotification);
+
+    editChannelCombo.addItem("Left", 1);
+    editChannelCombo.addItem("Right", 2);
+    editChannelCombo.setSelectedId(1, juce::dontSendNotification);
+    editChannelCombo.setEnabled(false);
+
+    for (int count = 1; count <= MAX_BANDS; ++count)
+        bandCountCombo.addItem(juce::String(count) + (count == 1 ? " Band" : " Bands"), count);
+    bandCountCombo.setSelectedId(parentWindow->getNumBands(), juce::dontSendNotification);
     
     loadButton.addListener(parentWindow);
     saveButton.addListener(parentWindow);
     resetButton.addListener(parentWindow);
+    linearPhaseButton.addListener(parentWindow);
+    stereoModeCombo.addListener(parentWindow);
+    editChannelCombo.addListener(parentWindow);
+    bandCountCombo.addListener(parentWindow);
     
     addAndMakeVisible(loadButton);
     addAndMakeVisible(saveButton);
     addAndMakeVisible(resetButton);
+    addAndMakeVisible(linearPhaseButton);
+    addAndMakeVisible(stereoModeCombo);
+    addAndMakeVisible(editChannelCombo);
+    addAndMakeVisible(bandCountCombo);
 }
@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "FrequencyResponseDisplay.h"
 #include "EQControls.h"
+#include "../SweepTestWindow/AutoEQFitter.h"
 
 // Forward declarations
 class IIRFilterProcessor;
@@ -36,9 +37,18 @@ public:
     void saveLimiterParams();
     void loadLimiterParams();
     void resetParamsToDefaults();
+
+    // Loads fitted bands into both channels as one linked curve, with the band count set to the fit's
+    void applyAutoEQ(const std::vector<AutoEQFitter::Band>& bands);
     
     // Callback for close button
     std::function<void()> onCloseButtonPressed;
+
+    // Bands with controls in the window, as many as the processor takes (IIRFilterProcessor::maxBands).
+    // The first getNumBands() are shown and processed; the band count box sets how many.
+    static constexpr int MAX_BANDS = 32;
+    static constexpr int DEFAULT_NUM_BANDS = 7;
+    int getNumBands() const { return numBands; }
     
     // Inner content class
     class EQContent : public juce::Component
@@ -60,6 +70,14 @@ public:
         juce::TextButton loadButton;
         juce::TextButton saveButton;
         juce::TextButton resetButton;
+        juce::ToggleButton linearPhaseButton;
+        juce::ComboBox stereoModeCombo;     // Linked, Left / Right, Mid / Side
+        juce::ComboBox editChannelCombo;    // Which channel's curve the band controls edit
+        juce::ComboBox bandCountCombo;      // Bands in use; item id = count
+
+        // The band controls, scrolled sideways once they no longer fit the window
+        juce::Component bandsContainer;
+        juce::Viewport bandsViewport;
 
     private:
         EQWindow* parentWindow;
@@ -75,7 +93,7 @@ public:
 private:
     // Processors
     IIRFilterProcessor* eqProcessor;
-    IIRFilterProcessor* secondEqProcessor = nullptr; // mirror updates to right channel
+    IIRFilterProcessor* secondEqProcessor = nullptr; // right channel, or side in mid/side mode
     LimiterProcessor* limiterProcessor = nullptr;
     
     // Viewport for scrolling
@@ -83,11 +101,35 @@ private:
     
     // Window size constants
     static constexpr int MINIMUM_CONTENT_WIDTH = 1100;
-    static constexpr int MINIMUM_CONTENT_HEIGHT = 850;
+    static constexpr int MINIMUM_CONTENT_HEIGHT = 900;
     
+    // Band settings per channel (left/mid, right/side); the band controls show editedChannel's.
+    // While linked, edits go to both.
+    struct BandSettings
+    {
+        bool enabled = true;
+        juce::String type = "PEQ";
+        double freq = 1000.0;
+        double gain = 0.0;
+        double q = 0.7;
+    };
+
+    BandSettings channelBands[2][MAX_BANDS];
+    int editedChannel = 0;
+    int numBands = DEFAULT_NUM_BANDS;
+
+    // Defaults: the first 7 bands an octave apart from 100 Hz, the rest spread evenly in log frequency
+    static BandSettings getDefaultBandSettings(int band);
+    void setNumBands(int newNumBands);
+
     // Helper methods
     void updateEQProcessor();
+    void updatePhaseMode();
+    void updateStereoMode();
+    bool isStereoLinked() const;
+    void showBandSettings(int channel);
     void updateLimiterProcessor();
+    void updateLimiterMeters();
     void updateDisplay();
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQWindow)
@@ -15,7 +15,7 @@ FrequencyResponseDisplay::FrequencyResponseDisplay(IIRFilterProcessor* proc)
     // Disable accessibility for child components
     setInterceptsMouseClicks(true, false);  // Do not intercept mouse events of child components
     
-    bandEnabled.resize(7, true);
+    bandEnabled.resize(EQWindow::MAX_BANDS, true);
     selectedBand = -1;
 }
 
@@ -151,7 +151,7 @@ void FrequencyResponseDisplay::paint(juce::Graphics& g)
     // Draw band points
     for (size_t i = 0; i < bandPoints.size(); ++i)
     {
-        if (i < bandEnabled.size() && bandEnabled[i] && i < 7)  // Ensure no more than 7 bands
+        if (i < bandEnabled.size() && bandEnabled[i])
         {
             float x = drawArea.getX() + frequencyToX(bandPoints[i].x, static_cast<float>(drawArea.getWidth()));
             float y = drawArea.getY() + gainToY(bandPoints[i].y, static_cast<float>(drawArea.getHeight()));
@@ -188,7 +188,7 @@ void FrequencyResponseDisplay::mouseDown(const juce::MouseEvent& event)
     if (drawArea.getWidth() <= 0 || drawArea.getHeight() <= 0)
         return;
     
-    for (size_t i = 0; i < bandPoints.size() && i < 7; ++i)
+    for (size_t i = 0; i < bandPoints.size(); ++i)
     {
         if (i < bandEnabled.size() && bandEnabled[i])
         {
@@ -207,7 +207,7 @@ void FrequencyResponseDisplay::mouseDown(const juce::MouseEvent& event)
 
 void FrequencyResponseDisplay::mouseDrag(const juce::MouseEvent& event)
 {
-    if (!isEnabled() || selectedBand < 0 || selectedBand >= 7)
+    if (!isEnabled() || selectedBand < 0 || selectedBand >= EQWindow::MAX_BANDS)
         return;
         
     if (selectedBand >= static_cast<int>(bandEnabled.size()) || !bandEnabled[selectedBand])
@@ -276,7 +276,8 @@ void FrequencyResponseDisplay::updateResponse()
     if (!parentWindow || !parentWindow->content)
         return;
 
-    const int maxBands = juce::jmin(7, parentWindow->content->eqBands.size());
+    // Only the bands in use; bandPoints follows, so the points drawn and dragged are theirs
+    const int maxBands = juce::jmin(parentWindow->getNumBands(), parentWindow->content->eqBands.size());
 
     // Record band information
     struct BandData {
@@ -49,6 +49,14 @@ float FxCathedralRevbDiffOutR   = 0.0f;
 float FxCathedralRevbCmb1InBuff = 0.0f;
 
 float FxCathedralRevbLfo        = 0.0f;
+uint32_t FxCathedralRevbModEnable = 1;      // 0 = LFO held, comb delays fixed (kept through init)
+
+// Silence detection
+float    FxCathedralRevbSleepEnergyIn  = 0.0f;  // Input energy of the current block
+float    FxCathedralRevbSleepEnergyOut = 0.0f;  // Output energy of the current block
+uint32_t FxCathedralRevbSleepCntr      = 0;     // Samples in the current block
+uint32_t FxCathedralRevbQuietCntr      = 0;     // Samples since the last non-silent block
+uint32_t FxCathedralRevbSleeping       = 0;     // 1 = tail has died out, output zeros
 
 float FxCathedralRevbCombModBuff[8];
 float FxCathedralRevbCombModFrac[8];
@@ -91,6 +99,48 @@ void FxCathedralRevbPrintStatus(void) {
     printf("  Tone: %.2f\n", FxCathedralRevbToneSet);
     printf("  Memory Offset: %u\n", FxCathedralRevbMemOffsetPtr);
     printf("  LFO: %.4f\n", FxCathedralRevbLfo);
+    printf("  Sleeping: %s\n", FxCathedralRevbSleeping ? "yes" : "no");
+}
+
+// Hold the comb LFO where it is (0) or let it run (1), e.g. to capture a time-invariant response
+void FxCathedralRevbSetModulation(uint32_t uEnable) {
+    FxCathedralRevbModEnable = uEnable;
+}
+
+// Whether the reverb tail has died out and processing is bypassed
+int FxCathedralRevbIsSleeping(void) {
+    return FxCathedralRevbSleeping != 0;
+}
+
+// Leave (or reset) the sleep state and restart energy tracking
+static void FxCathedralRevbWake(void) {
+    FxCathedralRevbSleeping       = 0;
+    FxCathedralRevbQuietCntr      = 0;
+    FxCathedralRevbSleepCntr      = 0;
+    FxCathedralRevbSleepEnergyIn  = 0.0f;
+    FxCathedralRevbSleepEnergyOut = 0.0f;
+}
+
+// Accumulate block energy, sleep once input and output stayed below -120 dBFS
+// for a full pass through the circular memory
+static inline void FxCathedralRevbSleepTrack(float fXnL, float fXnR, float fYnL, float fYnR) {
+    FxCathedralRevbSleepEnergyIn  += fXnL * fXnL + fXnR * fXnR;
+    FxCathedralRevbSleepEnergyOut += fYnL * fYnL + fYnR * fYnR;
+    if (++FxCathedralRevbSleepCntr < FX_CATHEDRAL_REVB_SLEEP_BLOCK)
+        return;
+    
+    if (FxCathedralRevbSleepEnergyIn < FX_CATHEDRAL_REVB_SLEEP_ENERGY &&
+        FxCathedralRevbSleepEnergyOut < FX_CATHEDRAL_REVB_SLEEP_ENERGY) {
+        FxCathedralRevbQuietCntr += FX_CATHEDRAL_REVB_SLEEP_BLOCK;
+        if (FxCathedralRevbQuietCntr >= FX_CATHEDRAL_REVB_SLEEP_HOLD)
+            FxCathedralRevbSleeping = 1;
+    } else {
+        FxCathedralRevbQuietCntr = 0;
+    }
+    
+    FxCathedralRevbSleepCntr      = 0;
+    FxCathedralRevbSleepEnergyIn  = 0.0f;
+    FxCathedralRevbSleepEnergyOut = 0.0f;
 }
 
 // Memory read/write helper functions
@@ -114,6 +164,25 @@ void FxCathedralRevbInit(float fDecay, float fTone) {
     // Clear memory
     FxCathedralRevbClearMemory();
     
+    // Reset states so a re-init renders exactly like a fresh start
+    FxCathedralRevbDecaySet     = fDecay;
+    FxCathedralRevbToneSet      = fTone;
+    FxCathedralRevbParaDezYn    = 0.0f;
+    FxCathedralRevbMemOffsetPtr = 0;
+    FxCathedralRevbInLpYnL      = 0.0f;
+    FxCathedralRevbInLpYnR      = 0.0f;
+    FxCathedralRevbInHpYnL      = 0.0f;
+    FxCathedralRevbInHpYnR      = 0.0f;
+    FxCathedralRevbDiffOutL     = 0.0f;
+    FxCathedralRevbDiffOutR     = 0.0f;
+    FxCathedralRevbCmb1InBuff   = 0.0f;
+    FxCathedralRevbLfo          = 0.0f;
+    memset(FxCathedralRevbCombModBuff, 0, sizeof(FxCathedralRevbCombModBuff));
+    memset(FxCathedralRevbCombModFrac, 0, sizeof(FxCathedralRevbCombModFrac));
+    memset(FxCathedralRevbCombInBuff, 0, sizeof(FxCathedralRevbCombInBuff));
+    memset(FxCathedralRevbDecayYn, 0, sizeof(FxCathedralRevbDecayYn));
+    FxCathedralRevbWake();
+    
     FxCathedralRevbParaDezYn = (1.0f - FX_CATHEDRAL_REVB_DEZAP_A0) * FxCathedralRevbParaDezYn + 
                                FX_CATHEDRAL_REVB_DEZAP_A0 * FxCathedralRevbDecaySet;
     
@@ -273,6 +342,16 @@ void FxCathedralRevbParaDezap(void) {
 
 // ==================== Main Processing Function ====================
 void FxCathedralRevbProcess(float fXnL, float fXnR, float *OutL, float *OutR) {
+    // Tail bypass: output silence until the input is non-silent again
+    if (FxCathedralRevbSleeping) {
+        if (fabsf(fXnL) <= FX_CATHEDRAL_REVB_SLEEP_LEVEL && fabsf(fXnR) <= FX_CATHEDRAL_REVB_SLEEP_LEVEL) {
+            *OutL = 0.0f;
+            *OutR = 0.0f;
+            return;
+        }
+        FxCathedralRevbWake();
+    }
+    
     FxCathedralRevbParaDezap();
     FxCathedralRevbUpdateAddTable();
     FxCathedralRevbInputFilter(fXnL, fXnR);
@@ -280,6 +359,7 @@ void FxCathedralRevbProcess(float fXnL, float fXnR, float *OutL, float *OutR) {
     FxCathedralRevbModulation();
     FxCathedralRevbDecayAndMix();
     FxCathedralRevbEarlyRefAndOut(OutL, OutR);
+    FxCathedralRevbSleepTrack(fXnL, fXnR, *OutL, *OutR);
 }
 
 // ==================== Update Address Table ====================
@@ -400,8 +480,10 @@ void FxCathedralRevbModulation(void) {
     uint32_t IntYn, Add;
     
     // LFO
-    FxCathedralRevbLfo = FxCathedralRevbLfo + FX_CATHEDRAL_REVB_LFO_DELTA;
-    FxCathedralRevbLfo = (FxCathedralRevbLfo >= 2.0f) ? (FxCathedralRevbLfo - 2.0f) : FxCathedralRevbLfo;
+    if (FxCathedralRevbModEnable) {
+        FxCathedralRevbLfo = FxCathedralRevbLfo + FX_CATHEDRAL_REVB_LFO_DELTA;
+        FxCathedralRevbLfo = (FxCathedralRevbLfo >= 2.0f) ? (FxCathedralRevbLfo - 2.0f) : FxCathedralRevbLfo;
+    }
     
     fTRI = (FxCathedralRevbLfo > 1.0f) ? (2.0f - FxCathedralRevbLfo) : FxCathedralRevbLfo;
     
@@ -49,6 +49,12 @@
 #define FX_CATHEDRAL_REVB_OUT_ER_GAIN           0.328f
 #define FX_CATHEDRAL_REVB_OUT_REV_GAIN          0.492f
 
+// Silence Detection (tail bypass)
+#define FX_CATHEDRAL_REVB_SLEEP_BLOCK           256                 // Energy measurement block in samples
+#define FX_CATHEDRAL_REVB_SLEEP_LEVEL           1.0e-6f             // -120 dBFS
+#define FX_CATHEDRAL_REVB_SLEEP_ENERGY          (FX_CATHEDRAL_REVB_SLEEP_LEVEL * FX_CATHEDRAL_REVB_SLEEP_LEVEL * FX_CATHEDRAL_REVB_SLEEP_BLOCK)
+#define FX_CATHEDRAL_REVB_SLEEP_HOLD            ((0x80000 / 4) + FX_CATHEDRAL_REVB_SLEEP_BLOCK)  // Full circular memory
+
 // PC platform compatibility macros
 #ifndef MAX
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
@@ -77,6 +83,8 @@ void FxCathedralRevbEarlyRefAndOut(float *OutL, float *OutR);
 // PC platform test functions
 void FxCathedralRevbClearMemory(void);
 void FxCathedralRevbPrintStatus(void);
+int FxCathedralRevbIsSleeping(void);
+void FxCathedralRevbSetModulation(uint32_t uEnable);
 
 #ifdef __cplusplus
 }
@@ -33,6 +33,13 @@ float FxDelayGainYn   = 0.0f;       // Low-pass filtered gain
 float FxDelayOutL     = 0.0f;       // Left channel output
 float FxDelayOutR     = 0.0f;       // Right channel output
 
+// ==================== Silence Detection ====================
+float    FxDelaySleepEnergyIn  = 0.0f;  // Input energy of the current block
+float    FxDelaySleepEnergyOut = 0.0f;  // Output energy of the current block
+uint32_t FxDelaySleepCntr      = 0;     // Samples in the current block
+uint32_t FxDelayQuietCntr      = 0;     // Samples since the last non-silent block
+uint32_t FxDelaySleeping       = 0;     // 1 = tail has died out, output zeros
+
 // ==================== PC Platform Utility Functions ====================
 
 /**
@@ -53,6 +60,7 @@ void FxDelayPrintStatus(void) {
     printf("  Memory Offset: %u\n", FxDelayMemOffsetPtr);
     printf("  Fade Counter: %.4f\n", FxDelayFadeCntr);
     printf("  Current Gain: %.4f\n", FxDelayGainYn);
+    printf("  Sleeping: %s\n", FxDelaySleeping ? "yes" : "no");
 }
 
 /**
@@ -63,6 +71,47 @@ float FxDelayGetCurrentDelayTime(void) {
     return (samples / 48000.0f) * 1000.0f; // Convert to ms assuming 48kHz
 }
 
+/**
+ * Whether the delay tail has died out and processing is bypassed
+ */
+int FxDelayIsSleeping(void) {
+    return FxDelaySleeping != 0;
+}
+
+/**
+ * Leave (or reset) the sleep state and restart energy tracking
+ */
+static void FxDelayWake(void) {
+    FxDelaySleeping       = 0;
+    FxDelayQuietCntr      = 0;
+    FxDelaySleepCntr      = 0;
+    FxDelaySleepEnergyIn  = 0.0f;
+    FxDelaySleepEnergyOut = 0.0f;
+}
+
+/**
+ * Accumulate block energy and enter sleep once input and output have stayed
+ * below -120 dBFS for longer than the longest echo
+ */
+static inline void FxDelaySleepTrack(float fXnL, float fXnR, float fYnL, float fYnR) {
+    FxDelaySleepEnergyIn  += fXnL * fXnL + fXnR * fXnR;
+    FxDelaySleepEnergyOut += fYnL * fYnL + fYnR * fYnR;
+    if (++FxDelaySleepCntr < FX_DELAY_SLEEP_BLOCK)
+        return;
+
+    if (FxDelaySleepEnergyIn < FX_DELAY_SLEEP_ENERGY && FxDelaySleepEnergyOut < FX_DELAY_SLEEP_ENERGY) {
+        FxDelayQuietCntr += FX_DELAY_SLEEP_BLOCK;
+        if (FxDelayQuietCntr >= FX_DELAY_SLEEP_HOLD)
+            FxDelaySleeping = 1;
+    } else {
+        FxDelayQuietCntr = 0;
+    }
+
+    FxDelaySleepCntr      = 0;
+    FxDelaySleepEnergyIn  = 0.0f;
+    FxDelaySleepEnergyOut = 0.0f;
+}
+
 /**
  * Memory read helper function
  */
@@ -98,6 +147,13 @@ void FxDelayInit(float fRepeat, float fTime) {
     FxDelayFadeCntr = 0.0f;
     FxDelayTime     = 0.0f;
     
+    // Reset states so a re-init renders exactly like a fresh start
+    FxDelayMemOffsetPtr = 0;
+    FxDelayGainYn       = 0.0f;
+    FxDelayOutL         = 0.0f;
+    FxDelayOutR         = 0.0f;
+    FxDelayWake();
+    
     // Initialize base addresses (converted to float indices)
     // These are the initial read positions for the delay lines
     FxDelayReadWriteBaseAddr[0] = 0x3DA80 / 4;  // Left channel read
@@ -160,6 +216,16 @@ void FxDelayParaDezap(void) {
  * @param OutR - Output right channel pointer
  */
 void FxDelayProcess(float fXnL, float fXnR, float *OutL, float *OutR) {
+    // Tail bypass: output silence until the input is non-silent again
+    if (FxDelaySleeping) {
+        if (fabsf(fXnL) <= FX_DELAY_SLEEP_LEVEL && fabsf(fXnR) <= FX_DELAY_SLEEP_LEVEL) {
+            *OutL = 0.0f;
+            *OutR = 0.0f;
+            return;
+        }
+        FxDelayWake();
+    }
+    
     // Step 1: Smooth parameter changes
     FxDelayParaDezap();
     
@@ -168,6 +234,9 @@ void FxDelayProcess(float fXnL, float fXnR, float *OutL, float *OutR) {
     
     // Step 3: Calculate delay output
     FxDelayCalcOutput(fXnL, fXnR, OutL, OutR);
+    
+    // Step 4: Track block energy for the tail bypass
+    FxDelaySleepTrack(fXnL, fXnR, *OutL, *OutR);
 }
 
 /**
@@ -34,6 +34,12 @@
 // Input Mixer
 #define FX_DELAY_GN_INPUT               0.707f          // Input gain (-3dB)
 
+// Silence Detection (tail bypass)
+#define FX_DELAY_SLEEP_BLOCK            256             // Energy measurement block in samples
+#define FX_DELAY_SLEEP_LEVEL            1.0e-6f         // -120 dBFS
+#define FX_DELAY_SLEEP_ENERGY           (FX_DELAY_SLEEP_LEVEL * FX_DELAY_SLEEP_LEVEL * FX_DELAY_SLEEP_BLOCK)
+#define FX_DELAY_SLEEP_HOLD             ((uint32_t)FX_DELAY_TIME_MAX + FX_DELAY_SLEEP_BLOCK)  // Longest echo path
+
 // PC Platform Compatibility Macros
 #ifndef MAX
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
@@ -61,6 +67,7 @@ void FxDelayCalcOutput(float fXnL, float fXnR, float *OutL, float *OutR);
 void FxDelayClearMemory(void);
 void FxDelayPrintStatus(void);
 float FxDelayGetCurrentDelayTime(void);
+int FxDelayIsSleeping(void);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,188 @@
+// ============================================================
+// effect_flanger.c - PC Platform Version
+// ============================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "effect_flanger.h"
+
+// ==================== PC Platform Utility Functions ====================
+
+/**
+ * Clear the flanger delay memory
+ */
+void FxFlangerClearMemory(FxFlangerState *pFx) {
+    memset(pFx->fBufL, 0, sizeof(pFx->fBufL));
+    memset(pFx->fBufR, 0, sizeof(pFx->fBufR));
+    pFx->uWritePos = 0;
+}
+
+/**
+ * Print current flanger status for debugging
+ */
+void FxFlangerPrintStatus(const FxFlangerState *pFx) {
+    printf("Flanger Effect Status:\n");
+    printf("  Rate Setting: %.2f (%.2f Hz)\n", pFx->fRateSet,
+           FX_FLANGER_RATE_MIN + (FX_FLANGER_RATE_MAX - FX_FLANGER_RATE_MIN) * pFx->fRate);
+    printf("  Depth Setting: %.2f\n", pFx->fDepthSet);
+    printf("  Sample Rate: %.0f Hz\n", pFx->fSampleRate);
+    printf("  LFO Phase: %.4f\n", (double)pFx->uLfoPhase / 4294967296.0);
+}
+
+/**
+ * One-pole smoothing coefficient equivalent to running the per-sample
+ * dezap filter uNumSamples times
+ */
+static inline float FxFlangerDezapCoef(uint32_t uNumSamples) {
+    if (uNumSamples == 1)
+        return FX_FLANGER_DEZAP_A0;
+    return 1.0f - powf(1.0f - FX_FLANGER_DEZAP_A0, (float)uNumSamples);
+}
+
+/**
+ * Linear-interpolated read from a circular buffer
+ * @param pBuf - Channel delay memory
+ * @param uWritePos - Position the current sample is written to
+ * @param fDelay - Delay in samples (>= 1.0)
+ */
+static inline float FxFlangerReadInterp(const float *pBuf, uint32_t uWritePos, float fDelay) {
+    uint32_t uInt  = (uint32_t)fDelay;
+    float    fFrac = fDelay - (float)uInt;
+    float    fS0   = pBuf[(uWritePos - uInt) & FX_FLANGER_BUFFER_MASK];
+    float    fS1   = pBuf[(uWritePos - uInt - 1) & FX_FLANGER_BUFFER_MASK];
+    return fS0 + fFrac * (fS1 - fS0);
+}
+
+// ==================== Main Functions ====================
+
+/**
+ * Initialize flanger effect
+ * @param pFx - Flanger instance
+ * @param fRate - LFO rate (0.0 to 1.0, mapped to 0.05Hz to 5Hz)
+ * @param fDepth - Sweep depth (0.0 to 1.0)
+ */
+void FxFlangerInit(FxFlangerState *pFx, float fRate, float fDepth) {
+    FxFlangerClearMemory(pFx);
+
+    pFx->fRateSet    = fRate;
+    pFx->fDepthSet   = fDepth;
+    pFx->fRate       = fRate;
+    pFx->fDepth      = fDepth;
+    pFx->uLfoPhase   = 0;
+    pFx->fSampleRate = FX_FLANGER_DEFAULT_SAMPLE_RATE;
+
+    printf("Flanger initialized: Rate=%.2f, Depth=%.2f\n", fRate, fDepth);
+}
+
+/**
+ * Set processing sample rate; clears the delay memory
+ * @param pFx - Flanger instance
+ * @param fSampleRate - Sample rate in Hz
+ */
+void FxFlangerSetSampleRate(FxFlangerState *pFx, float fSampleRate) {
+    // The sweep must fit in the delay memory at the highest supported rate
+    pFx->fSampleRate = MIN(MAX(fSampleRate, 8000.0f), FX_FLANGER_MAX_SAMPLE_RATE);
+    FxFlangerClearMemory(pFx);
+}
+
+/**
+ * Update user parameters
+ * @param pFx - Flanger instance
+ * @param fRate - New LFO rate (0.0 to 1.0)
+ * @param fDepth - New sweep depth (0.0 to 1.0)
+ */
+void FxFlangerParaUpdate(FxFlangerState *pFx, float fRate, float fDepth) {
+    pFx->fRateSet  = fRate;
+    pFx->fDepthSet = fDepth;
+}
+
+/**
+ * Process one sub-block (uNumSamples <= FX_FLANGER_SUB_BLOCK)
+ */
+static void FxFlangerProcessSubBlock(FxFlangerState *pFx, const float *pXnL, const float *pXnR,
+                                     float *pOutL, float *pOutR, uint32_t uNumSamples) {
+    uint32_t i, uPhaseInc;
+    float fDepthStart, fDepthStep;
+    float fDelayMin, fDelayRange, fCoef;
+    uint32_t uPhase0   = pFx->uLfoPhase;
+    uint32_t uWritePos = pFx->uWritePos;
+
+    // Step 1: Smooth parameter changes once per sub-block
+    fCoef        = FxFlangerDezapCoef(uNumSamples);
+    fDepthStart  = pFx->fDepth;
+    pFx->fRate  += fCoef * (pFx->fRateSet - pFx->fRate);
+    pFx->fDepth += fCoef * (pFx->fDepthSet - pFx->fDepth);
+    fDepthStep   = (pFx->fDepth - fDepthStart) / (float)uNumSamples;
+
+    uPhaseInc   = (uint32_t)((FX_FLANGER_RATE_MIN + (FX_FLANGER_RATE_MAX - FX_FLANGER_RATE_MIN) * pFx->fRate)
+                / pFx->fSampleRate * 4294967296.0);
+    fDelayMin   = FX_FLANGER_DELAY_MIN_MS * 0.001f * pFx->fSampleRate;
+    fDelayRange = (FX_FLANGER_DELAY_MAX_MS - FX_FLANGER_DELAY_MIN_MS) * 0.001f * pFx->fSampleRate;
+
+    // Step 2: Triangle LFO to modulated delay times (branch-free, vectorizable)
+    for (i = 0; i < uNumSamples; i++) {
+        uint32_t uPhL  = uPhase0 + uPhaseInc * i;
+        uint32_t uPhR  = uPhL + FX_FLANGER_STEREO_PHASE;
+        float fPhL     = (float)(int32_t)(uPhL >> 8) * (1.0f / 16777216.0f);
+        float fPhR     = (float)(int32_t)(uPhR >> 8) * (1.0f / 16777216.0f);
+        float fDepth   = fDepthStart + fDepthStep * (float)(i + 1);
+        pFx->fDelayL[i] = fDelayMin + fDepth * fDelayRange * fabsf(2.0f * fPhL - 1.0f);
+        pFx->fDelayR[i] = fDelayMin + fDepth * fDelayRange * fabsf(2.0f * fPhR - 1.0f);
+    }
+
+    pFx->uLfoPhase = uPhase0 + uPhaseInc * uNumSamples;
+
+    // Step 3: Interpolated read and feedback write (recursive through the delay memory)
+    for (i = 0; i < uNumSamples; i++) {
+        float fWetL = FxFlangerReadInterp(pFx->fBufL, uWritePos, pFx->fDelayL[i]);
+        float fWetR = FxFlangerReadInterp(pFx->fBufR, uWritePos, pFx->fDelayR[i]);
+
+        pFx->fBufL[uWritePos & FX_FLANGER_BUFFER_MASK] = pXnL[i] + FX_FLANGER_FEEDBACK * fWetL;
+        pFx->fBufR[uWritePos & FX_FLANGER_BUFFER_MASK] = pXnR[i] + FX_FLANGER_FEEDBACK * fWetR;
+        uWritePos++;
+
+        pFx->fWetL[i] = fWetL;
+        pFx->fWetR[i] = fWetR;
+    }
+    pFx->uWritePos = uWritePos;
+
+    // Step 4: Dry/wet mix (vectorizable, safe for in-place buffers)
+    for (i = 0; i < uNumSamples; i++) {
+        pOutL[i] = (1.0f - FX_FLANGER_MIX) * pXnL[i] + FX_FLANGER_MIX * pFx->fWetL[i];
+        pOutR[i] = (1.0f - FX_FLANGER_MIX) * pXnR[i] + FX_FLANGER_MIX * pFx->fWetR[i];
+    }
+}
+
+/**
+ * Block flanger processing function; input and output may alias
+ * @param pFx - Flanger instance
+ * @param pXnL - Input left channel
+ * @param pXnR - Input right channel
+ * @param pOutL - Output left channel
+ * @param pOutR - Output right channel
+ * @param uNumSamples - Number of samples
+ */
+void FxFlangerProcessBlock(FxFlangerState *pFx, const float *pXnL, const float *pXnR,
+                           float *pOutL, float *pOutR, uint32_t uNumSamples) {
+    while (uNumSamples > 0) {
+        uint32_t uChunk = MIN(uNumSamples, (uint32_t)FX_FLANGER_SUB_BLOCK);
+        FxFlangerProcessSubBlock(pFx, pXnL, pXnR, pOutL, pOutR, uChunk);
+        pXnL += uChunk;
+        pXnR += uChunk;
+        pOutL += uChunk;
+        pOutR += uChunk;
+        uNumSamples -= uChunk;
+    }
+}
+
+/**
+ * Main flanger processing function (single sample)
+ * @param pFx - Flanger instance
+ * @param fXnL - Input left channel
+ * @param fXnR - Input right channel
+ * @param OutL - Output left channel pointer
+ * @param OutR - Output right channel pointer
+ */
+void FxFlangerProcess(FxFlangerState *pFx, float fXnL, float fXnR, float *OutL, float *OutR) {
+    FxFlangerProcessSubBlock(pFx, &fXnL, &fXnR, OutL, OutR, 1);
+}
@@ -0,0 +1,93 @@
+// effect_flanger.h - PC Platform Version
+#ifndef __EFFECT_FLANGER_H__
+#define __EFFECT_FLANGER_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// ==================== Basic Definitions ====================
+// Per-channel delay memory, power of two so the circular index is a mask
+#define FX_FLANGER_BUFFER_SIZE          4096
+#define FX_FLANGER_BUFFER_MASK          (FX_FLANGER_BUFFER_SIZE - 1)
+
+// Block processing granularity (parameters are ramped per sub-block)
+#define FX_FLANGER_SUB_BLOCK            64
+
+#define FX_FLANGER_DEFAULT_SAMPLE_RATE  48000.0f
+#define FX_FLANGER_MAX_SAMPLE_RATE      192000.0f
+
+// ==================== Parameter Definitions ====================
+// Parameter Smoothing
+#define FX_FLANGER_DEZAP_A0             0.001f          // Smoothing coefficient (per sample)
+
+// Modulated Delay Range
+#define FX_FLANGER_DELAY_MIN_MS         0.5f            // Sweep lower bound
+#define FX_FLANGER_DELAY_MAX_MS         8.0f            // Sweep upper bound at full depth
+
+// LFO
+#define FX_FLANGER_RATE_MIN             0.05f           // Hz at fRate = 0.0
+#define FX_FLANGER_RATE_MAX             5.0f            // Hz at fRate = 1.0
+#define FX_FLANGER_STEREO_PHASE         0x40000000u     // Right LFO offset (90 degrees of 2^32)
+
+// Feedback and Output Mixer
+#define FX_FLANGER_FEEDBACK             0.6f
+#define FX_FLANGER_MIX                  0.5f            // Wet amount, dry = 1 - mix
+
+// PC Platform Compatibility Macros
+#ifndef MAX
+#define MAX(a,b) ((a) > (b) ? (a) : (b))
+#endif
+
+#ifndef MIN
+#define MIN(a,b) ((a) < (b) ? (a) : (b))
+#endif
+
+// ==================== Instance State ====================
+typedef struct
+{
+    // Delay memory
+    float    fBufL[FX_FLANGER_BUFFER_SIZE];
+    float    fBufR[FX_FLANGER_BUFFER_SIZE];
+    uint32_t uWritePos;
+
+    // User parameters (0.0~1.0)
+    float    fRateSet;
+    float    fDepthSet;
+
+    // Smoothed parameters
+    float    fRate;
+    float    fDepth;
+
+    // LFO (32-bit phase accumulator, exact for any block split)
+    uint32_t uLfoPhase;
+    float    fSampleRate;
+
+    // Block scratch
+    float    fDelayL[FX_FLANGER_SUB_BLOCK];
+    float    fDelayR[FX_FLANGER_SUB_BLOCK];
+    float    fWetL[FX_FLANGER_SUB_BLOCK];
+    float    fWetR[FX_FLANGER_SUB_BLOCK];
+} FxFlangerState;
+
+// ==================== Function Declarations ====================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void FxFlangerInit(FxFlangerState *pFx, float fRate, float fDepth);
+void FxFlangerSetSampleRate(FxFlangerState *pFx, float fSampleRate);
+void FxFlangerParaUpdate(FxFlangerState *pFx, float fRate, float fDepth);
+void FxFlangerProcess(FxFlangerState *pFx, float fXnL, float fXnR, float *OutL, float *OutR);
+void FxFlangerProcessBlock(FxFlangerState *pFx, const float *pXnL, const float *pXnR,
+                           float *pOutL, float *pOutR, uint32_t uNumSamples);
+
+// PC Platform Utility Functions
+void FxFlangerClearMemory(FxFlangerState *pFx);
+void FxFlangerPrintStatus(const FxFlangerState *pFx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __EFFECT_FLANGER_H__
@@ -0,0 +1,190 @@
+// ============================================================
+// effect_pitch.c - PC Platform Version
+// ============================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "effect_pitch.h"
+
+// ==================== PC Platform Utility Functions ====================
+
+/**
+ * Clear the pitch shifter delay memory
+ */
+void FxPitchClearMemory(FxPitchState *pFx) {
+    memset(pFx->fBufL, 0, sizeof(pFx->fBufL));
+    memset(pFx->fBufR, 0, sizeof(pFx->fBufR));
+    pFx->uWritePos = 0;
+}
+
+/**
+ * Get the requested pitch offset in semitones (semitone step + fine detune)
+ */
+float FxPitchGetTargetShift(const FxPitchState *pFx) {
+    float fSemis = floorf((pFx->fSemitoneSet - 0.5f) * 2.0f * FX_PITCH_SEMITONE_RANGE + 0.5f);
+    float fCents = (pFx->fDetuneSet - 0.5f) * 2.0f * FX_PITCH_DETUNE_RANGE;
+    return fSemis + fCents * 0.01f;
+}
+
+/**
+ * Print current pitch shifter status for debugging
+ */
+void FxPitchPrintStatus(const FxPitchState *pFx) {
+    printf("Pitch Shift Effect Status:\n");
+    printf("  Semitone Setting: %.2f\n", pFx->fSemitoneSet);
+    printf("  Detune Setting: %.2f\n", pFx->fDetuneSet);
+    printf("  Target Shift: %+.2f semitones\n", FxPitchGetTargetShift(pFx));
+    printf("  Current Shift: %+.2f semitones\n", pFx->fShift);
+    printf("  Window: %.0f samples\n", pFx->fWindow);
+}
+
+/**
+ * Read the delay memory at uWritePos - fDelay with linear interpolation
+ */
+static inline float FxPitchReadInterp(const float *pBuf, uint32_t uWritePos, float fDelay) {
+    uint32_t uInt  = (uint32_t)fDelay;
+    float    fFrac = fDelay - (float)uInt;
+    float    fS0   = pBuf[(uWritePos - uInt) & FX_PITCH_BUFFER_MASK];
+    float    fS1   = pBuf[(uWritePos - uInt - 1) & FX_PITCH_BUFFER_MASK];
+    return fS0 + fFrac * (fS1 - fS0);
+}
+
+// ==================== Main Functions ====================
+
+/**
+ * Initialize pitch shift effect
+ * @param pFx - Pitch shifter instance
+ * @param fSemitone - Semitone step (0.0 to 1.0, mapped to -12 to +12)
+ * @param fDetune - Fine detune (0.0 to 1.0, mapped to -50 to +50 cents)
+ */
+void FxPitchInit(FxPitchState *pFx, float fSemitone, float fDetune) {
+    pFx->fSemitoneSet = fSemitone;
+    pFx->fDetuneSet   = fDetune;
+    pFx->fShift       = FxPitchGetTargetShift(pFx);
+    pFx->fRatioShift  = pFx->fShift;
+    pFx->fRatio       = powf(2.0f, pFx->fShift / 12.0f);
+    pFx->uPhase       = 0;
+    FxPitchSetSampleRate(pFx, FX_PITCH_DEFAULT_SAMPLE_RATE);
+
+    printf("Pitch shift initialized: Semitone=%.2f, Detune=%.2f (%+.2f st)\n",
+           fSemitone, fDetune, pFx->fShift);
+}
+
+/**
+ * Set processing sample rate; clears the delay memory
+ * @param pFx - Pitch shifter instance
+ * @param fSampleRate - Sample rate in Hz
+ */
+void FxPitchSetSampleRate(FxPitchState *pFx, float fSampleRate) {
+    pFx->fSampleRate = fSampleRate;
+    pFx->fWindow     = MIN(FX_PITCH_WINDOW_MS * 0.001f * fSampleRate, (float)FX_PITCH_WINDOW_MAX);
+    FxPitchClearMemory(pFx);
+}
+
+/**
+ * Update user parameters
+ * @param pFx - Pitch shifter instance
+ * @param fSemitone - New semitone step (0.0 to 1.0)
+ * @param fDetune - New fine detune (0.0 to 1.0)
+ */
+void FxPitchParaUpdate(FxPitchState *pFx, float fSemitone, float fDetune) {
+    pFx->fSemitoneSet = fSemitone;
+    pFx->fDetuneSet   = fDetune;
+}
+
+/**
+ * Process one sub-block (uNumSamples <= FX_PITCH_SUB_BLOCK)
+ *
+ * Two read taps sweep the window half a period apart. Each tap is faded
+ * out with a triangular gain before it wraps, and the two gains always sum
+ * to one, so the splice is inaudible for steady material.
+ */
+static void FxPitchProcessSubBlock(FxPitchState *pFx, const float *pXnL, const float *pXnR,
+                                   float *pOutL, float *pOutR, uint32_t uNumSamples) {
+    uint32_t i, uStart, uFirst, uPhaseInc;
+    float fCoef;
+    uint32_t uPhase0   = pFx->uPhase;
+    uint32_t uWritePos = pFx->uWritePos;
+
+    // Step 1: Smooth the pitch offset and derive the ratio once per sub-block
+    fCoef = (uNumSamples == 1) ? FX_PITCH_DEZAP_A0
+                               : 1.0f - powf(1.0f - FX_PITCH_DEZAP_A0, (float)uNumSamples);
+    pFx->fShift += fCoef * (FxPitchGetTargetShift(pFx) - pFx->fShift);
+    if (pFx->fShift != pFx->fRatioShift) {
+        pFx->fRatioShift = pFx->fShift;
+        pFx->fRatio      = powf(2.0f, pFx->fShift / 12.0f);
+    }
+    // Signed increment wrapped into the unsigned accumulator
+    uPhaseInc = (uint32_t)(int32_t)((1.0f - pFx->fRatio) / pFx->fWindow * 4294967296.0);
+
+    // Step 2: Write the whole sub-block first so the taps can read it back
+    uStart = uWritePos & FX_PITCH_BUFFER_MASK;
+    uFirst = MIN(uNumSamples, FX_PITCH_BUFFER_SIZE - uStart);
+    memcpy(&pFx->fBufL[uStart], pXnL, uFirst * sizeof(float));
+    memcpy(&pFx->fBufR[uStart], pXnR, uFirst * sizeof(float));
+    if (uFirst < uNumSamples) {
+        memcpy(pFx->fBufL, pXnL + uFirst, (uNumSamples - uFirst) * sizeof(float));
+        memcpy(pFx->fBufR, pXnR + uFirst, (uNumSamples - uFirst) * sizeof(float));
+    }
+
+    // Step 3: Tap delays and crossfade gains (branch-free, vectorizable)
+    for (i = 0; i < uNumSamples; i++) {
+        uint32_t uPhA = uPhase0 + uPhaseInc * (i + 1);
+        uint32_t uPhB = uPhA + 0x80000000u;
+        float fPhA = (float)(int32_t)(uPhA >> 8) * (1.0f / 16777216.0f);
+        float fPhB = (float)(int32_t)(uPhB >> 8) * (1.0f / 16777216.0f);
+        pFx->fDelayA[i] = FX_PITCH_DELAY_MIN + fPhA * pFx->fWindow;
+        pFx->fDelayB[i] = FX_PITCH_DELAY_MIN + fPhB * pFx->fWindow;
+        pFx->fGainA[i]  = 1.0f - fabsf(2.0f * fPhA - 1.0f);
+    }
+
+    pFx->uPhase = uPhase0 + uPhaseInc * uNumSamples;
+
+    // Step 4: Interpolated dual-tap read and crossfade
+    for (i = 0; i < uNumSamples; i++) {
+        uint32_t uPos = uWritePos + i;
+        float fGainA = pFx->fGainA[i];
+        float fAL = FxPitchReadInterp(pFx->fBufL, uPos, pFx->fDelayA[i]);
+        float fBL = FxPitchReadInterp(pFx->fBufL, uPos, pFx->fDelayB[i]);
+        float fAR = FxPitchReadInterp(pFx->fBufR, uPos, pFx->fDelayA[i]);
+        float fBR = FxPitchReadInterp(pFx->fBufR, uPos, pFx->fDelayB[i]);
+        pOutL[i] = fBL + fGainA * (fAL - fBL);
+        pOutR[i] = fBR + fGainA * (fAR - fBR);
+    }
+
+    pFx->uWritePos = uWritePos + uNumSamples;
+}
+
+/**
+ * Block pitch shift processing function; input and output may alias
+ * @param pFx - Pitch shifter instance
+ * @param pXnL - Input left channel
+ * @param pXnR - Input right channel
+ * @param pOutL - Output left channel
+ * @param pOutR - Output right channel
+ * @param uNumSamples - Number of samples
+ */
+void FxPitchProcessBlock(FxPitchState *pFx, const float *pXnL, const float *pXnR,
+                         float *pOutL, float *pOutR, uint32_t uNumSamples) {
+    while (uNumSamples > 0) {
+        uint32_t uChunk = MIN(uNumSamples, (uint32_t)FX_PITCH_SUB_BLOCK);
+        FxPitchProcessSubBlock(pFx, pXnL, pXnR, pOutL, pOutR, uChunk);
+        pXnL += uChunk;
+        pXnR += uChunk;
+        pOutL += uChunk;
+        pOutR += uChunk;
+        uNumSamples -= uChunk;
+    }
+}
+
+/**
+ * Main pitch shift processing function (single sample)
+ * @param pFx - Pitch shifter instance
+ * @param fXnL - Input left channel
+ * @param fXnR - Input right channel
+ * @param OutL - Output left channel pointer
+ * @param OutR - Output right channel pointer
+ */
+void FxPitchProcess(FxPitchState *pFx, float fXnL, float fXnR, float *OutL, float *OutR) {
+    FxPitchProcessSubBlock(pFx, &fXnL, &fXnR, OutL, OutR, 1);
+}
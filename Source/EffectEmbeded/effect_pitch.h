@@ -0,0 +1,90 @@
+// effect_pitch.h - PC Platform Version
+#ifndef __EFFECT_PITCH_H__
+#define __EFFECT_PITCH_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// ==================== Basic Definitions ====================
+// Per-channel delay memory, power of two so the circular index is a mask
+#define FX_PITCH_BUFFER_SIZE            8192
+#define FX_PITCH_BUFFER_MASK            (FX_PITCH_BUFFER_SIZE - 1)
+
+// Block processing granularity; window + sub-block must fit in the buffer
+#define FX_PITCH_SUB_BLOCK              64
+
+#define FX_PITCH_DEFAULT_SAMPLE_RATE    48000.0f
+
+// ==================== Parameter Definitions ====================
+// Parameter Smoothing
+#define FX_PITCH_DEZAP_A0               0.001f
+
+// Dual-tap Window
+#define FX_PITCH_WINDOW_MS              40.0f           // Sweep length of each read tap
+#define FX_PITCH_WINDOW_MAX             (FX_PITCH_BUFFER_SIZE - FX_PITCH_SUB_BLOCK - 4)
+#define FX_PITCH_DELAY_MIN              1.0f            // Samples, keeps the interpolation causal
+
+// Parameter Mapping
+#define FX_PITCH_SEMITONE_RANGE         12.0f           // fSemitone 0.0~1.0 -> -12~+12 semitones
+#define FX_PITCH_DETUNE_RANGE           50.0f           // fDetune 0.0~1.0 -> -50~+50 cents
+
+// PC Platform Compatibility Macros
+#ifndef MAX
+#define MAX(a,b) ((a) > (b) ? (a) : (b))
+#endif
+
+#ifndef MIN
+#define MIN(a,b) ((a) < (b) ? (a) : (b))
+#endif
+
+// ==================== Instance State ====================
+typedef struct
+{
+    // Delay memory
+    float    fBufL[FX_PITCH_BUFFER_SIZE];
+    float    fBufR[FX_PITCH_BUFFER_SIZE];
+    uint32_t uWritePos;
+
+    // User parameters (0.0~1.0)
+    float    fSemitoneSet;
+    float    fDetuneSet;
+
+    // Smoothed pitch offset in semitones and the ratio derived from it
+    float    fShift;
+    float    fRatioShift;
+    float    fRatio;
+
+    // Tap phase (32-bit accumulator over the window, exact for any block split)
+    uint32_t uPhase;
+    float    fWindow;
+    float    fSampleRate;
+
+    // Block scratch
+    float    fDelayA[FX_PITCH_SUB_BLOCK];
+    float    fDelayB[FX_PITCH_SUB_BLOCK];
+    float    fGainA[FX_PITCH_SUB_BLOCK];
+} FxPitchState;
+
+// ==================== Function Declarations ====================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void FxPitchInit(FxPitchState *pFx, float fSemitone, float fDetune);
+void FxPitchSetSampleRate(FxPitchState *pFx, float fSampleRate);
+void FxPitchParaUpdate(FxPitchState *pFx, float fSemitone, float fDetune);
+void FxPitchProcess(FxPitchState *pFx, float fXnL, float fXnR, float *OutL, float *OutR);
+void FxPitchProcessBlock(FxPitchState *pFx, const float *pXnL, const float *pXnR,
+                         float *pOutL, float *pOutR, uint32_t uNumSamples);
+
+// PC Platform Utility Functions
+void FxPitchClearMemory(FxPitchState *pFx);
+void FxPitchPrintStatus(const FxPitchState *pFx);
+float FxPitchGetTargetShift(const FxPitchState *pFx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __EFFECT_PITCH_H__
@@ -0,0 +1,342 @@
+// ============================================================
+// effect_plate_reverb.c - PC Platform Version
+// ============================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "effect_plate_reverb.h"
+
+// ==================== Line Layout ====================
+// 0-3  : input diffusers
+// 4-7  : left tank  (modulated allpass, delay, allpass, delay)
+// 8-11 : right tank (modulated allpass, delay, allpass, delay)
+static const float FxPlateRevbLineLengths[FX_PLATE_REVB_LINE_COUNT] = {
+    142.0f, 107.0f, 379.0f, 277.0f,
+    672.0f, 4453.0f, 1800.0f, 3720.0f,
+    908.0f, 4217.0f, 2656.0f, 3163.0f
+};
+
+// Power-of-two memory per line, sized for FX_PLATE_REVB_MAX_SAMPLE_RATE
+static const uint32_t FxPlateRevbLineSizes[FX_PLATE_REVB_LINE_COUNT] = {
+    512, 512, 2048, 1024,
+    4096, 16384, 8192, 16384,
+    4096, 16384, 16384, 16384
+};
+
+// Output taps: line, offset at design rate, sign
+static const uint32_t FxPlateRevbTapLineL[FX_PLATE_REVB_TAP_COUNT] = { 9, 9, 10, 11, 5, 6, 7 };
+static const float    FxPlateRevbTapOffsL[FX_PLATE_REVB_TAP_COUNT] = { 266.0f, 2974.0f, 1913.0f, 1996.0f, 1990.0f, 187.0f, 1066.0f };
+static const uint32_t FxPlateRevbTapLineR[FX_PLATE_REVB_TAP_COUNT] = { 5, 5, 6, 7, 9, 10, 11 };
+static const float    FxPlateRevbTapOffsR[FX_PLATE_REVB_TAP_COUNT] = { 353.0f, 3627.0f, 1228.0f, 2673.0f, 2111.0f, 335.0f, 121.0f };
+static const float    FxPlateRevbTapSign[FX_PLATE_REVB_TAP_COUNT]  = { 1.0f, 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+
+static const float FxPlateRevbInDiff[4] = {
+    FX_PLATE_REVB_IN_DIFF1, FX_PLATE_REVB_IN_DIFF1, FX_PLATE_REVB_IN_DIFF2, FX_PLATE_REVB_IN_DIFF2
+};
+
+// ==================== PC Platform Utility Functions ====================
+
+/**
+ * Clear the reverb memory and filter states
+ */
+void FxPlateRevbClearMemory(FxPlateRevbState *pFx) {
+    memset(pFx->fMemory, 0, sizeof(pFx->fMemory));
+    pFx->uWritePos    = 0;
+    pFx->fBandwidthYn = 0.0f;
+    pFx->fDampYnL     = 0.0f;
+    pFx->fDampYnR     = 0.0f;
+}
+
+/**
+ * Print current plate reverb status for debugging
+ */
+void FxPlateRevbPrintStatus(const FxPlateRevbState *pFx) {
+    printf("Plate Reverb Effect Status:\n");
+    printf("  Decay Setting: %.2f (tank gain %.3f)\n", pFx->fDecaySet, pFx->fDecay);
+    printf("  Tone Setting: %.2f (damping %.3f)\n", pFx->fToneSet, pFx->fDamp);
+    printf("  Sample Rate: %.0f Hz\n", pFx->fSampleRate);
+    printf("  Tank Delay L/R: %u / %u samples\n", pFx->Lines[5].uDelay, pFx->Lines[9].uDelay);
+}
+
+/**
+ * Copy uNumSamples from a line, starting uDelay samples behind the write position
+ */
+static inline void FxPlateRevbReadLine(const FxPlateRevbState *pFx, const FxPlateRevbLine *pLine,
+                                       uint32_t uDelay, float *pDst, uint32_t uNumSamples) {
+    uint32_t uStart = (pFx->uWritePos - uDelay) & pLine->uMask;
+    uint32_t uFirst = MIN(uNumSamples, pLine->uMask + 1 - uStart);
+    memcpy(pDst, &pFx->fMemory[pLine->uBase + uStart], uFirst * sizeof(float));
+    if (uFirst < uNumSamples)
+        memcpy(pDst + uFirst, &pFx->fMemory[pLine->uBase], (uNumSamples - uFirst) * sizeof(float));
+}
+
+/**
+ * Copy uNumSamples into a line at the write position
+ */
+static inline void FxPlateRevbWriteLine(FxPlateRevbState *pFx, const FxPlateRevbLine *pLine,
+                                        const float *pSrc, uint32_t uNumSamples) {
+    uint32_t uStart = pFx->uWritePos & pLine->uMask;
+    uint32_t uFirst = MIN(uNumSamples, pLine->uMask + 1 - uStart);
+    memcpy(&pFx->fMemory[pLine->uBase + uStart], pSrc, uFirst * sizeof(float));
+    if (uFirst < uNumSamples)
+        memcpy(&pFx->fMemory[pLine->uBase], pSrc + uFirst, (uNumSamples - uFirst) * sizeof(float));
+}
+
+/**
+ * Allpass over a block, in place. The line delay is never shorter than a
+ * sub-block, so the delayed segment can be fetched before any of it is written.
+ */
+static void FxPlateRevbAllpass(FxPlateRevbState *pFx, const FxPlateRevbLine *pLine, float fGain,
+                               float *pXn, float *pTmp, uint32_t uNumSamples) {
+    uint32_t i;
+
+    FxPlateRevbReadLine(pFx, pLine, pLine->uDelay, pTmp, uNumSamples);
+    for (i = 0; i < uNumSamples; i++) {
+        float fV = pXn[i] - fGain * pTmp[i];
+        pXn[i]   = pTmp[i] + fGain * fV;
+        pTmp[i]  = fV;
+    }
+    FxPlateRevbWriteLine(pFx, pLine, pTmp, uNumSamples);
+}
+
+/**
+ * Allpass with a per-sample fractional delay (linear interpolation), in place
+ */
+static void FxPlateRevbModAllpass(FxPlateRevbState *pFx, const FxPlateRevbLine *pLine, float fGain,
+                                  const float *pDelay, float *pXn, float *pTmp, uint32_t uNumSamples) {
+    uint32_t i;
+    const float *pMem = &pFx->fMemory[pLine->uBase];
+
+    for (i = 0; i < uNumSamples; i++) {
+        uint32_t uInt  = (uint32_t)pDelay[i];
+        float    fFrac = pDelay[i] - (float)uInt;
+        uint32_t uPos  = pFx->uWritePos + i - uInt;
+        float    fS0   = pMem[uPos & pLine->uMask];
+        float    fS1   = pMem[(uPos - 1) & pLine->uMask];
+        pTmp[i] = fS0 + fFrac * (fS1 - fS0);
+    }
+    for (i = 0; i < uNumSamples; i++) {
+        float fV = pXn[i] - fGain * pTmp[i];
+        pXn[i]   = pTmp[i] + fGain * fV;
+        pTmp[i]  = fV;
+    }
+    FxPlateRevbWriteLine(pFx, pLine, pTmp, uNumSamples);
+}
+
+/**
+ * Damping low-pass followed by the decay gain, in place
+ */
+static float FxPlateRevbDamp(float *pXn, float fYn, float fDamp, float fDecay, uint32_t uNumSamples) {
+    uint32_t i;
+    for (i = 0; i < uNumSamples; i++) {
+        fYn = (1.0f - fDamp) * pXn[i] + fDamp * fYn;
+        pXn[i] = fDecay * fYn;
+    }
+    return fYn;
+}
+
+/**
+ * Modulated delay times from a parabolic sine LFO (branch-free, vectorizable)
+ */
+static void FxPlateRevbLfo(float *pDelay, float fBase, float fDepth,
+                           uint32_t uPhase0, uint32_t uPhaseInc, uint32_t uNumSamples) {
+    uint32_t i;
+    for (i = 0; i < uNumSamples; i++) {
+        uint32_t uPh = uPhase0 + uPhaseInc * (i + 1);
+        float fX = (float)(int32_t)uPh * (1.0f / 2147483648.0f);   // -1.0~1.0
+        pDelay[i] = fBase + fDepth * 4.0f * fX * (1.0f - fabsf(fX));
+    }
+}
+
+/**
+ * Sum the output taps of one channel
+ */
+static void FxPlateRevbOutputTaps(FxPlateRevbState *pFx, const uint32_t *pTapLines, const uint32_t *pTapOffs,
+                                  float *pOut, uint32_t uNumSamples) {
+    uint32_t i, t;
+
+    for (i = 0; i < uNumSamples; i++)
+        pOut[i] = 0.0f;
+
+    for (t = 0; t < FX_PLATE_REVB_TAP_COUNT; t++) {
+        float fGain = FX_PLATE_REVB_OUT_GAIN * FxPlateRevbTapSign[t];
+        FxPlateRevbReadLine(pFx, &pFx->Lines[pTapLines[t]], pTapOffs[t], pFx->fScratchB, uNumSamples);
+        for (i = 0; i < uNumSamples; i++)
+            pOut[i] += fGain * pFx->fScratchB[i];
+    }
+}
+
+// ==================== Main Functions ====================
+
+/**
+ * Initialize plate reverb effect
+ * @param pFx - Plate reverb instance
+ * @param fDecay - Decay amount (0.0 to 1.0)
+ * @param fTone - Tone (0.0 = dark, 1.0 = bright)
+ */
+void FxPlateRevbInit(FxPlateRevbState *pFx, float fDecay, float fTone) {
+    pFx->uLfoPhase = 0;
+    pFx->uModEnable = 1;
+    FxPlateRevbSetSampleRate(pFx, FX_PLATE_REVB_DEFAULT_SAMPLE_RATE);
+
+    pFx->fDecaySet = fDecay;
+    pFx->fToneSet  = fTone;
+    pFx->fDecay    = FX_PLATE_REVB_DECAY_MIN + (FX_PLATE_REVB_DECAY_MAX - FX_PLATE_REVB_DECAY_MIN) * fDecay;
+    pFx->fDamp     = FX_PLATE_REVB_DAMP_DARK + (FX_PLATE_REVB_DAMP_BRIGHT - FX_PLATE_REVB_DAMP_DARK) * fTone;
+
+    printf("Plate reverb initialized: Decay=%.2f, Tone=%.2f\n", fDecay, fTone);
+}
+
+/**
+ * Set processing sample rate; rescales all lines and clears the memory
+ * @param pFx - Plate reverb instance
+ * @param fSampleRate - Sample rate in Hz
+ */
+void FxPlateRevbSetSampleRate(FxPlateRevbState *pFx, float fSampleRate) {
+    uint32_t i, uBase = 0;
+    float fScale;
+
+    // Below 16kHz the shortest diffuser would be shorter than a sub-block
+    pFx->fSampleRate = MAX(fSampleRate, 16000.0f);
+    fScale = MIN(pFx->fSampleRate, FX_PLATE_REVB_MAX_SAMPLE_RATE) / FX_PLATE_REVB_DESIGN_RATE;
+
+    for (i = 0; i < FX_PLATE_REVB_LINE_COUNT; i++) {
+        pFx->Lines[i].uBase  = uBase;
+        pFx->Lines[i].uMask  = FxPlateRevbLineSizes[i] - 1;
+        pFx->Lines[i].uDelay = (uint32_t)(FxPlateRevbLineLengths[i] * fScale + 0.5f);
+        uBase += FxPlateRevbLineSizes[i];
+    }
+
+    for (i = 0; i < FX_PLATE_REVB_TAP_COUNT; i++) {
+        pFx->uTapsL[i] = (uint32_t)(FxPlateRevbTapOffsL[i] * fScale + 0.5f);
+        pFx->uTapsR[i] = (uint32_t)(FxPlateRevbTapOffsR[i] * fScale + 0.5f);
+    }
+
+    pFx->fModDepth = pFx->uModEnable ? FX_PLATE_REVB_MOD_EXCURSION * fScale : 0.0f;
+    FxPlateRevbClearMemory(pFx);
+}
+
+/**
+ * Let the tank modulation run, or fix the tank delays at their base lengths
+ * @param pFx - Plate reverb instance
+ * @param uEnable - 1 = modulated, 0 = time-invariant (e.g. to capture an impulse response)
+ */
+void FxPlateRevbSetModulation(FxPlateRevbState *pFx, uint32_t uEnable) {
+    float fScale = MIN(pFx->fSampleRate, FX_PLATE_REVB_MAX_SAMPLE_RATE) / FX_PLATE_REVB_DESIGN_RATE;
+
+    pFx->uModEnable = uEnable;
+    pFx->fModDepth  = uEnable ? FX_PLATE_REVB_MOD_EXCURSION * fScale : 0.0f;
+}
+
+/**
+ * Update user parameters
+ * @param pFx - Plate reverb instance
+ * @param fDecay - New decay amount (0.0 to 1.0)
+ * @param fTone - New tone (0.0 to 1.0)
+ */
+void FxPlateRevbParaUpdate(FxPlateRevbState *pFx, float fDecay, float fTone) {
+    pFx->fDecaySet = fDecay;
+    pFx->fToneSet  = fTone;
+}
+
+/**
+ * Process one sub-block (uNumSamples <= FX_PLATE_REVB_SUB_BLOCK)
+ */
+static void FxPlateRevbProcessSubBlock(FxPlateRevbState *pFx, const float *pXnL, const float *pXnR,
+                                       float *pOutL, float *pOutR, uint32_t uNumSamples) {
+    uint32_t i;
+    float fCoef, fTarget, fYn;
+    uint32_t uPhase0 = pFx->uLfoPhase;
+    uint32_t uPhaseInc = (uint32_t)(FX_PLATE_REVB_MOD_RATE / pFx->fSampleRate * 4294967296.0);
+    float *pIn  = pFx->fScratchA;
+    float *pTmp = pFx->fScratchB;
+
+    // Step 1: Smooth parameter changes once per sub-block
+    fCoef = (uNumSamples == 1) ? FX_PLATE_REVB_DEZAP_A0
+                               : 1.0f - powf(1.0f - FX_PLATE_REVB_DEZAP_A0, (float)uNumSamples);
+    fTarget      = FX_PLATE_REVB_DECAY_MIN + (FX_PLATE_REVB_DECAY_MAX - FX_PLATE_REVB_DECAY_MIN) * pFx->fDecaySet;
+    pFx->fDecay += fCoef * (fTarget - pFx->fDecay);
+    fTarget      = FX_PLATE_REVB_DAMP_DARK + (FX_PLATE_REVB_DAMP_BRIGHT - FX_PLATE_REVB_DAMP_DARK) * pFx->fToneSet;
+    pFx->fDamp  += fCoef * (fTarget - pFx->fDamp);
+
+    // Step 2: Mono input, bandwidth filter and input diffusers
+    for (i = 0; i < uNumSamples; i++)
+        pIn[i] = 0.5f * (pXnL[i] + pXnR[i]);
+
+    fYn = pFx->fBandwidthYn;
+    for (i = 0; i < uNumSamples; i++) {
+        fYn = FX_PLATE_REVB_BANDWIDTH * pIn[i] + (1.0f - FX_PLATE_REVB_BANDWIDTH) * fYn;
+        pIn[i] = fYn;
+    }
+    pFx->fBandwidthYn = fYn;
+
+    for (i = 0; i < 4; i++)
+        FxPlateRevbAllpass(pFx, &pFx->Lines[i], FxPlateRevbInDiff[i], pIn, pTmp, uNumSamples);
+
+    // Step 3: Cross-feed from the end of the opposite tank half
+    FxPlateRevbReadLine(pFx, &pFx->Lines[11], pFx->Lines[11].uDelay, pFx->fTankL, uNumSamples);
+    FxPlateRevbReadLine(pFx, &pFx->Lines[7], pFx->Lines[7].uDelay, pFx->fTankR, uNumSamples);
+    for (i = 0; i < uNumSamples; i++) {
+        pFx->fTankL[i] = pIn[i] + pFx->fDecay * pFx->fTankL[i];
+        pFx->fTankR[i] = pIn[i] + pFx->fDecay * pFx->fTankR[i];
+    }
+
+    // Step 4: Left tank half, modulated by the in-phase LFO
+    FxPlateRevbLfo(pFx->fModDelay, (float)pFx->Lines[4].uDelay, pFx->fModDepth, uPhase0, uPhaseInc, uNumSamples);
+    FxPlateRevbModAllpass(pFx, &pFx->Lines[4], FX_PLATE_REVB_DECAY_DIFF1, pFx->fModDelay, pFx->fTankL, pTmp, uNumSamples);
+    FxPlateRevbWriteLine(pFx, &pFx->Lines[5], pFx->fTankL, uNumSamples);
+    FxPlateRevbReadLine(pFx, &pFx->Lines[5], pFx->Lines[5].uDelay, pFx->fTankL, uNumSamples);
+    pFx->fDampYnL = FxPlateRevbDamp(pFx->fTankL, pFx->fDampYnL, pFx->fDamp, pFx->fDecay, uNumSamples);
+    FxPlateRevbAllpass(pFx, &pFx->Lines[6], FX_PLATE_REVB_DECAY_DIFF2, pFx->fTankL, pTmp, uNumSamples);
+    FxPlateRevbWriteLine(pFx, &pFx->Lines[7], pFx->fTankL, uNumSamples);
+
+    // Step 5: Right tank half, modulated by the quadrature LFO
+    FxPlateRevbLfo(pFx->fModDelay, (float)pFx->Lines[8].uDelay, pFx->fModDepth,
+                   uPhase0 + 0x40000000u, uPhaseInc, uNumSamples);
+    FxPlateRevbModAllpass(pFx, &pFx->Lines[8], FX_PLATE_REVB_DECAY_DIFF1, pFx->fModDelay, pFx->fTankR, pTmp, uNumSamples);
+    FxPlateRevbWriteLine(pFx, &pFx->Lines[9], pFx->fTankR, uNumSamples);
+    FxPlateRevbReadLine(pFx, &pFx->Lines[9], pFx->Lines[9].uDelay, pFx->fTankR, uNumSamples);
+    pFx->fDampYnR = FxPlateRevbDamp(pFx->fTankR, pFx->fDampYnR, pFx->fDamp, pFx->fDecay, uNumSamples);
+    FxPlateRevbAllpass(pFx, &pFx->Lines[10], FX_PLATE_REVB_DECAY_DIFF2, pFx->fTankR, pTmp, uNumSamples);
+    FxPlateRevbWriteLine(pFx, &pFx->Lines[11], pFx->fTankR, uNumSamples);
+
+    // Step 6: Output taps (read after this sub-block has been written)
+    FxPlateRevbOutputTaps(pFx, FxPlateRevbTapLineL, pFx->uTapsL, pOutL, uNumSamples);
+    FxPlateRevbOutputTaps(pFx, FxPlateRevbTapLineR, pFx->uTapsR, pOutR, uNumSamples);
+    pFx->uWritePos += uNumSamples;
+    pFx->uLfoPhase  = uPhase0 + uPhaseInc * uNumSamples;
+}
+
+/**
+ * Block plate reverb processing function; input and output may alias
+ * @param pFx - Plate reverb instance
+ * @param pXnL - Input left channel
+ * @param pXnR - Input right channel
+ * @param pOutL - Output left channel
+ * @param pOutR - Output right channel
+ * @param uNumSamples - Number of samples
+ */
+void FxPlateRevbProcessBlock(FxPlateRevbState *pFx, const float *pXnL, const float *pXnR,
+                             float *pOutL, float *pOutR, uint32_t uNumSamples) {
+    while (uNumSamples > 0) {
+        uint32_t uChunk = MIN(uNumSamples, (uint32_t)FX_PLATE_REVB_SUB_BLOCK);
+        FxPlateRevbProcessSubBlock(pFx, pXnL, pXnR, pOutL, pOutR, uChunk);
+        pXnL += uChunk;
+        pXnR += uChunk;
+        pOutL += uChunk;
+        pOutR += uChunk;
+        uNumSamples -= uChunk;
+    }
+}
+
+/**
+ * Main plate reverb processing function (single sample)
+ * @param pFx - Plate reverb instance
+ * @param fXnL - Input left channel
+ * @param fXnR - Input right channel
+ * @param OutL - Output left channel pointer
+ * @param OutR - Output right channel pointer
+ */
+void FxPlateRevbProcess(FxPlateRevbState *pFx, float fXnL, float fXnR, float *OutL, float *OutR) {
+    FxPlateRevbProcessSubBlock(pFx, &fXnL, &fXnR, OutL, OutR, 1);
+}
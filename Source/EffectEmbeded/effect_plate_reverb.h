@@ -0,0 +1,120 @@
+// effect_plate_reverb.h - PC Platform Version
+#ifndef __EFFECT_PLATE_REVERB_H__
+#define __EFFECT_PLATE_REVERB_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// ==================== Basic Definitions ====================
+// Plate topology (input diffusers + figure-of-eight tank), lengths defined at 29761 Hz
+#define FX_PLATE_REVB_LINE_COUNT            12
+#define FX_PLATE_REVB_TAP_COUNT             7
+#define FX_PLATE_REVB_DESIGN_RATE           29761.0f
+
+// PC Platform Memory Size Definition - 400KB, enough for every line at 96kHz
+#define FX_PLATE_REVB_RAM_SIZE              (400 * 1024)  // 400KB
+#define FX_PLATE_REVB_RAM_SIZE_FLOATS       (FX_PLATE_REVB_RAM_SIZE / sizeof(float))  // in float units
+#define FX_PLATE_REVB_MAX_SAMPLE_RATE       96000.0f      // Higher rates run the lines at 96kHz lengths
+
+// Block processing granularity; must stay below the shortest line at the lowest rate
+#define FX_PLATE_REVB_SUB_BLOCK             32
+#define FX_PLATE_REVB_DEFAULT_SAMPLE_RATE   48000.0f
+
+// ==================== Parameter Definitions ====================
+// Parameter Smoothing
+#define FX_PLATE_REVB_DEZAP_A0              0.001f
+
+// Input
+#define FX_PLATE_REVB_BANDWIDTH             0.9995f
+#define FX_PLATE_REVB_IN_DIFF1              0.75f
+#define FX_PLATE_REVB_IN_DIFF2              0.625f
+
+// Tank
+#define FX_PLATE_REVB_DECAY_DIFF1           -0.70f          // Modulated allpass
+#define FX_PLATE_REVB_DECAY_DIFF2           0.50f
+#define FX_PLATE_REVB_DECAY_MIN             0.20f
+#define FX_PLATE_REVB_DECAY_MAX             0.95f
+#define FX_PLATE_REVB_DAMP_DARK             0.70f           // fTone = 0.0
+#define FX_PLATE_REVB_DAMP_BRIGHT           0.05f           // fTone = 1.0
+
+// Tank Modulation
+#define FX_PLATE_REVB_MOD_EXCURSION         16.0f           // Samples at design rate
+#define FX_PLATE_REVB_MOD_RATE              1.0f            // Hz
+
+// Output Mixer
+#define FX_PLATE_REVB_OUT_GAIN              0.6f
+
+// PC Platform Compatibility Macros
+#ifndef MAX
+#define MAX(a,b) ((a) > (b) ? (a) : (b))
+#endif
+
+#ifndef MIN
+#define MIN(a,b) ((a) < (b) ? (a) : (b))
+#endif
+
+// ==================== Instance State ====================
+typedef struct
+{
+    uint32_t uBase;         // Offset into fMemory
+    uint32_t uMask;         // Line size - 1 (power of two)
+    uint32_t uDelay;        // Delay length in samples
+} FxPlateRevbLine;
+
+typedef struct
+{
+    // Simulated SDRAM shared by all delay lines
+    float           fMemory[FX_PLATE_REVB_RAM_SIZE_FLOATS];
+    FxPlateRevbLine Lines[FX_PLATE_REVB_LINE_COUNT];
+    uint32_t        uTapsL[FX_PLATE_REVB_TAP_COUNT];
+    uint32_t        uTapsR[FX_PLATE_REVB_TAP_COUNT];
+    uint32_t        uWritePos;
+
+    // User parameters (0.0~1.0)
+    float           fDecaySet;
+    float           fToneSet;
+
+    // Smoothed parameters
+    float           fDecay;
+    float           fDamp;
+
+    // States
+    float           fBandwidthYn;
+    float           fDampYnL;
+    float           fDampYnR;
+    uint32_t        uLfoPhase;      // 32-bit accumulator, exact for any block split
+    uint32_t        uModEnable;     // 0 = tank delays fixed
+    float           fModDepth;
+    float           fSampleRate;
+
+    // Block scratch
+    float           fScratchA[FX_PLATE_REVB_SUB_BLOCK];
+    float           fScratchB[FX_PLATE_REVB_SUB_BLOCK];
+    float           fTankL[FX_PLATE_REVB_SUB_BLOCK];
+    float           fTankR[FX_PLATE_REVB_SUB_BLOCK];
+    float           fModDelay[FX_PLATE_REVB_SUB_BLOCK];
+} FxPlateRevbState;
+
+// ==================== Function Declarations ====================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void FxPlateRevbInit(FxPlateRevbState *pFx, float fDecay, float fTone);
+void FxPlateRevbSetSampleRate(FxPlateRevbState *pFx, float fSampleRate);
+void FxPlateRevbParaUpdate(FxPlateRevbState *pFx, float fDecay, float fTone);
+void FxPlateRevbProcess(FxPlateRevbState *pFx, float fXnL, float fXnR, float *OutL, float *OutR);
+void FxPlateRevbProcessBlock(FxPlateRevbState *pFx, const float *pXnL, const float *pXnR,
+                             float *pOutL, float *pOutR, uint32_t uNumSamples);
+
+// PC Platform Utility Functions
+void FxPlateRevbClearMemory(FxPlateRevbState *pFx);
+void FxPlateRevbPrintStatus(const FxPlateRevbState *pFx);
+void FxPlateRevbSetModulation(FxPlateRevbState *pFx, uint32_t uEnable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __EFFECT_PLATE_REVERB_H__
@@ -0,0 +1,661 @@
+// ============================================================
+// effect_regression.c - PC Platform Version
+// ============================================================
+//
+// Golden-vector regression and ns/sample benchmark for the embedded effects.
+// Builds standalone on any PC toolchain, e.g.
+//   gcc -O2 -DFX_REGRESSION_MAIN Source/EffectEmbeded/*.c -lm -o fx_regression
+//   fx_regression record <dir>      write golden outputs
+//   fx_regression check <dir> [tol] compare every API/block size against them
+//   fx_regression fingerprint <dir> print effect_regression_golden.h from them
+//   fx_regression verify [tol] [fx] compare every API/block size against the committed fingerprints
+//   fx_regression bench             print ns/sample per effect and block size
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L     // clock_gettime
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "effect_regression.h"
+#include "effect_regression_golden.h"
+#include "effect_delay.h"
+#include "effect_cathedral_reverb.h"
+#include "effect_flanger.h"
+#include "effect_plate_reverb.h"
+#include "effect_pitch.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// ==================== Effect Instances ====================
+// Instance-based effects are large, keep them out of the stack
+static FxFlangerState   FxRegressionFlanger;
+static FxPlateRevbState FxRegressionPlateRevb;
+static FxPitchState     FxRegressionPitch;
+
+// Fixed parameter set every golden is rendered with
+static const float FxRegressionPara[FX_REGRESSION_EFFECT_COUNT][2] = {
+    { 0.5f,  0.3f },    // Delay: repeat, time
+    { 0.5f,  0.5f },    // Cathedral: decay, tone
+    { 0.5f,  0.7f },    // Flanger: rate, depth
+    { 0.7f,  0.5f },    // Plate: decay, tone
+    { 0.75f, 0.5f },    // Pitch: +6 semitones, no detune
+};
+
+// ==================== Utility Functions ====================
+
+const char *FxRegressionEffectName(FxRegressionEffect eEffect) {
+    switch (eEffect) {
+        case FX_REGRESSION_EFFECT_DELAY:            return "delay";
+        case FX_REGRESSION_EFFECT_CATHEDRAL_REVB:   return "cathedral";
+        case FX_REGRESSION_EFFECT_FLANGER:          return "flanger";
+        case FX_REGRESSION_EFFECT_PLATE_REVB:       return "plate";
+        case FX_REGRESSION_EFFECT_PITCH:            return "pitch";
+        default:                                    return "unknown";
+    }
+}
+
+const char *FxRegressionSignalName(FxRegressionSignal eSignal) {
+    switch (eSignal) {
+        case FX_REGRESSION_SIGNAL_IMPULSE:  return "impulse";
+        case FX_REGRESSION_SIGNAL_NOISE:    return "noise";
+        case FX_REGRESSION_SIGNAL_SWEEP:    return "sweep";
+        default:                            return "unknown";
+    }
+}
+
+/**
+ * Whether the effect exposes a ProcessBlock entry point
+ */
+int FxRegressionHasBlockApi(FxRegressionEffect eEffect) {
+    return eEffect == FX_REGRESSION_EFFECT_FLANGER
+        || eEffect == FX_REGRESSION_EFFECT_PLATE_REVB
+        || eEffect == FX_REGRESSION_EFFECT_PITCH;
+}
+
+/**
+ * Monotonic time in nanoseconds
+ */
+static double FxRegressionNowNs(void) {
+#ifdef _WIN32
+    LARGE_INTEGER Freq, Count;
+    QueryPerformanceFrequency(&Freq);
+    QueryPerformanceCounter(&Count);
+    return (double)Count.QuadPart * 1.0e9 / (double)Freq.QuadPart;
+#else
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (double)Ts.tv_sec * 1.0e9 + (double)Ts.tv_nsec;
+#endif
+}
+
+/**
+ * Deterministic white noise (LCG), identical on every platform
+ */
+static float FxRegressionNoise(uint32_t *pSeed) {
+    *pSeed = *pSeed * 1664525u + 1013904223u;
+    return (float)(int32_t)*pSeed * (1.0f / 2147483648.0f);
+}
+
+/**
+ * Generate a stereo test signal
+ * @param eSignal - Signal type
+ * @param pXnL - Left channel output
+ * @param pXnR - Right channel output
+ * @param uNumSamples - Number of samples
+ */
+void FxRegressionMakeSignal(FxRegressionSignal eSignal, float *pXnL, float *pXnR, uint32_t uNumSamples) {
+    uint32_t i;
+    uint32_t uSeedL = 0x12345678u;
+    uint32_t uSeedR = 0x9E3779B9u;
+    double fDuration, fK;
+
+    memset(pXnL, 0, uNumSamples * sizeof(float));
+    memset(pXnR, 0, uNumSamples * sizeof(float));
+
+    switch (eSignal) {
+        case FX_REGRESSION_SIGNAL_IMPULSE:
+            // Offset the right impulse so the channels are distinguishable
+            if (uNumSamples > 0) pXnL[0] = 1.0f;
+            if (uNumSamples > 1) pXnR[1] = 1.0f;
+            break;
+
+        case FX_REGRESSION_SIGNAL_NOISE:
+            for (i = 0; i < uNumSamples; i++) {
+                pXnL[i] = FX_REGRESSION_SIGNAL_LEVEL * FxRegressionNoise(&uSeedL);
+                pXnR[i] = FX_REGRESSION_SIGNAL_LEVEL * FxRegressionNoise(&uSeedR);
+            }
+            break;
+
+        case FX_REGRESSION_SIGNAL_SWEEP:
+            // Exponential sweep, phase evaluated in double so it is reproducible
+            fDuration = (double)uNumSamples / FX_REGRESSION_SAMPLE_RATE;
+            fK = log((double)FX_REGRESSION_SWEEP_END_HZ / FX_REGRESSION_SWEEP_START_HZ);
+            for (i = 0; i < uNumSamples; i++) {
+                double fT = (double)i / FX_REGRESSION_SAMPLE_RATE;
+                double fPhase = 2.0 * 3.14159265358979323846 * FX_REGRESSION_SWEEP_START_HZ * fDuration / fK
+                              * (exp(fT / fDuration * fK) - 1.0);
+                pXnL[i] = FX_REGRESSION_SIGNAL_LEVEL * (float)sin(fPhase);
+                pXnR[i] = FX_REGRESSION_SIGNAL_LEVEL * (float)cos(fPhase);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+// ==================== Render ====================
+
+/**
+ * Render an effect from a freshly initialized state
+ * @param eEffect - Effect to render
+ * @param pXnL - Input left channel
+ * @param pXnR - Input right channel
+ * @param pOutL - Output left channel
+ * @param pOutR - Output right channel
+ * @param uNumSamples - Number of samples
+ * @param uBlockSize - 0 for the per-sample API, otherwise the ProcessBlock call size
+ */
+void FxRegressionRender(FxRegressionEffect eEffect, const float *pXnL, const float *pXnR,
+                        float *pOutL, float *pOutR, uint32_t uNumSamples, uint32_t uBlockSize) {
+    uint32_t i, uChunk;
+    float fPara0 = FxRegressionPara[eEffect][0];
+    float fPara1 = FxRegressionPara[eEffect][1];
+
+    // Step 1: Initialize to a known state
+    switch (eEffect) {
+        case FX_REGRESSION_EFFECT_DELAY:
+            FxDelayInit(fPara0, fPara1);
+            break;
+        case FX_REGRESSION_EFFECT_CATHEDRAL_REVB:
+            FxCathedralRevbInit(fPara0, fPara1);
+            break;
+        case FX_REGRESSION_EFFECT_FLANGER:
+            FxFlangerInit(&FxRegressionFlanger, fPara0, fPara1);
+            FxFlangerSetSampleRate(&FxRegressionFlanger, FX_REGRESSION_SAMPLE_RATE);
+            break;
+        case FX_REGRESSION_EFFECT_PLATE_REVB:
+            FxPlateRevbInit(&FxRegressionPlateRevb, fPara0, fPara1);
+            FxPlateRevbSetSampleRate(&FxRegressionPlateRevb, FX_REGRESSION_SAMPLE_RATE);
+            break;
+        case FX_REGRESSION_EFFECT_PITCH:
+            FxPitchInit(&FxRegressionPitch, fPara0, fPara1);
+            FxPitchSetSampleRate(&FxRegressionPitch, FX_REGRESSION_SAMPLE_RATE);
+            break;
+        default:
+            return;
+    }
+
+    // Step 2: Per-sample API
+    if (uBlockSize == 0 || !FxRegressionHasBlockApi(eEffect)) {
+        for (i = 0; i < uNumSamples; i++) {
+            switch (eEffect) {
+                case FX_REGRESSION_EFFECT_DELAY:
+                    FxDelayProcess(pXnL[i], pXnR[i], &pOutL[i], &pOutR[i]);
+                    break;
+                case FX_REGRESSION_EFFECT_CATHEDRAL_REVB:
+                    FxCathedralRevbProcess(pXnL[i], pXnR[i], &pOutL[i], &pOutR[i]);
+                    break;
+                case FX_REGRESSION_EFFECT_FLANGER:
+                    FxFlangerProcess(&FxRegressionFlanger, pXnL[i], pXnR[i], &pOutL[i], &pOutR[i]);
+                    break;
+                case FX_REGRESSION_EFFECT_PLATE_REVB:
+                    FxPlateRevbProcess(&FxRegressionPlateRevb, pXnL[i], pXnR[i], &pOutL[i], &pOutR[i]);
+                    break;
+                case FX_REGRESSION_EFFECT_PITCH:
+                    FxPitchProcess(&FxRegressionPitch, pXnL[i], pXnR[i], &pOutL[i], &pOutR[i]);
+                    break;
+                default:
+                    break;
+            }
+        }
+        return;
+    }
+
+    // Step 3: Block API, last call may be a partial block
+    for (i = 0; i < uNumSamples; i += uChunk) {
+        uChunk = MIN(uBlockSize, uNumSamples - i);
+        switch (eEffect) {
+            case FX_REGRESSION_EFFECT_FLANGER:
+                FxFlangerProcessBlock(&FxRegressionFlanger, pXnL + i, pXnR + i, pOutL + i, pOutR + i, uChunk);
+                break;
+            case FX_REGRESSION_EFFECT_PLATE_REVB:
+                FxPlateRevbProcessBlock(&FxRegressionPlateRevb, pXnL + i, pXnR + i, pOutL + i, pOutR + i, uChunk);
+                break;
+            case FX_REGRESSION_EFFECT_PITCH:
+                FxPitchProcessBlock(&FxRegressionPitch, pXnL + i, pXnR + i, pOutL + i, pOutR + i, uChunk);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// ==================== Golden Files ====================
+
+static void FxRegressionGoldenPath(char *pPath, size_t uSize, const char *pDir,
+                                   FxRegressionEffect eEffect, FxRegressionSignal eSignal) {
+    snprintf(pPath, uSize, "%s/%s_%s.f32", pDir,
+             FxRegressionEffectName(eEffect), FxRegressionSignalName(eSignal));
+}
+
+/**
+ * Render every effect/signal pair with the per-sample API and store the result
+ * @param pDir - Existing output directory
+ * @return Number of files that could not be written
+ */
+int FxRegressionRecord(const char *pDir) {
+    uint32_t uSize = FX_REGRESSION_NUM_SAMPLES;
+    float *pXnL  = (float *)malloc(uSize * sizeof(float));
+    float *pXnR  = (float *)malloc(uSize * sizeof(float));
+    float *pOutL = (float *)malloc(uSize * sizeof(float));
+    float *pOutR = (float *)malloc(uSize * sizeof(float));
+    float *pFile = (float *)malloc(2 * uSize * sizeof(float));
+    int iEffect, iSignal, iFailures = 0;
+    uint32_t i;
+    char Path[512];
+
+    if (!pXnL || !pXnR || !pOutL || !pOutR || !pFile) {
+        printf("Regression: out of memory\n");
+        iFailures = 1;
+        goto cleanup;
+    }
+
+    for (iSignal = 0; iSignal < FX_REGRESSION_SIGNAL_COUNT; iSignal++) {
+        FxRegressionMakeSignal((FxRegressionSignal)iSignal, pXnL, pXnR, uSize);
+
+        for (iEffect = 0; iEffect < FX_REGRESSION_EFFECT_COUNT; iEffect++) {
+            FILE *pFp;
+
+            FxRegressionRender((FxRegressionEffect)iEffect, pXnL, pXnR, pOutL, pOutR, uSize, 0);
+            for (i = 0; i < uSize; i++) {
+                pFile[2 * i]     = pOutL[i];
+                pFile[2 * i + 1] = pOutR[i];
+            }
+
+            FxRegressionGoldenPath(Path, sizeof(Path), pDir, (FxRegressionEffect)iEffect, (FxRegressionSignal)iSignal);
+            pFp = fopen(Path, "wb");
+            if (!pFp || fwrite(pFile, sizeof(float), 2 * uSize, pFp) != 2 * uSize) {
+                printf("Regression: failed to write %s\n", Path);
+                iFailures++;
+            } else {
+                printf("Regression: recorded %s\n", Path);
+            }
+            if (pFp) fclose(pFp);
+        }
+    }
+
+cleanup:
+    free(pXnL);
+    free(pXnR);
+    free(pOutL);
+    free(pOutR);
+    free(pFile);
+    return iFailures;
+}
+
+/**
+ * Max absolute error between a stereo render and an interleaved golden
+ * @param puFirst - Receives the first sample index exceeding fTolerance
+ */
+static float FxRegressionCompare(const float *pOutL, const float *pOutR, const float *pGolden,
+                                 uint32_t uNumSamples, float fTolerance, uint32_t *puFirst) {
+    uint32_t i;
+    float fMaxErr = 0.0f;
+
+    *puFirst = uNumSamples;
+    for (i = 0; i < uNumSamples; i++) {
+        float fErr = MAX(fabsf(pOutL[i] - pGolden[2 * i]), fabsf(pOutR[i] - pGolden[2 * i + 1]));
+        // A NaN never compares greater, treat it as an unbounded error
+        if (fErr != fErr) fErr = INFINITY;
+        if (fErr > fTolerance && *puFirst == uNumSamples) *puFirst = i;
+        fMaxErr = MAX(fMaxErr, fErr);
+    }
+    return fMaxErr;
+}
+
+/**
+ * Compare the per-sample API and every block size against the golden files
+ * @param pDir - Directory written by FxRegressionRecord
+ * @param fTolerance - Max absolute error per sample
+ * @return Number of failed comparisons
+ */
+int FxRegressionCheck(const char *pDir, float fTolerance) {
+    uint32_t uSize = FX_REGRESSION_NUM_SAMPLES;
+    float *pXnL   = (float *)malloc(uSize * sizeof(float));
+    float *pXnR   = (float *)malloc(uSize * sizeof(float));
+    float *pOutL  = (float *)malloc(uSize * sizeof(float));
+    float *pOutR  = (float *)malloc(uSize * sizeof(float));
+    float *pGolden = (float *)malloc(2 * uSize * sizeof(float));
+    int iEffect, iSignal, iFailures = 0, iChecks = 0;
+    char Path[512];
+
+    if (!pXnL || !pXnR || !pOutL || !pOutR || !pGolden) {
+        printf("Regression: out of memory\n");
+        iFailures = 1;
+        goto cleanup;
+    }
+
+    for (iSignal = 0; iSignal < FX_REGRESSION_SIGNAL_COUNT; iSignal++) {
+        FxRegressionMakeSignal((FxRegressionSignal)iSignal, pXnL, pXnR, uSize);
+
+        for (iEffect = 0; iEffect < FX_REGRESSION_EFFECT_COUNT; iEffect++) {
+            FxRegressionEffect eEffect = (FxRegressionEffect)iEffect;
+            FILE *pFp;
+            size_t uRead = 0;
+            uint32_t uBlock;
+
+            FxRegressionGoldenPath(Path, sizeof(Path), pDir, eEffect, (FxRegressionSignal)iSignal);
+            pFp = fopen(Path, "rb");
+            if (pFp) {
+                uRead = fread(pGolden, sizeof(float), 2 * uSize, pFp);
+                fclose(pFp);
+            }
+            if (uRead != 2 * uSize) {
+                printf("FAIL %-10s %-8s missing or short golden %s\n",
+                       FxRegressionEffectName(eEffect), FxRegressionSignalName((FxRegressionSignal)iSignal), Path);
+                iFailures++;
+                continue;
+            }
+
+            // Block size 0 is the per-sample API, the rest only apply to block-capable effects
+            for (uBlock = 0; uBlock <= FX_REGRESSION_BLOCK_MAX;
+                 uBlock = (uBlock == 0) ? FX_REGRESSION_BLOCK_MIN : uBlock * 2) {
+                uint32_t uFirst;
+                float fMaxErr;
+
+                if (uBlock != 0 && !FxRegressionHasBlockApi(eEffect))
+                    break;
+
+                FxRegressionRender(eEffect, pXnL, pXnR, pOutL, pOutR, uSize, uBlock);
+                fMaxErr = FxRegressionCompare(pOutL, pOutR, pGolden, uSize, fTolerance, &uFirst);
+                iChecks++;
+
+                if (uFirst < uSize) {
+                    printf("FAIL %-10s %-8s block %4u: max err %.3e, first at sample %u\n",
+                           FxRegressionEffectName(eEffect), FxRegressionSignalName((FxRegressionSignal)iSignal),
+                           uBlock, fMaxErr, uFirst);
+                    iFailures++;
+                } else {
+                    printf("ok   %-10s %-8s block %4u: max err %.3e\n",
+                           FxRegressionEffectName(eEffect), FxRegressionSignalName((FxRegressionSignal)iSignal),
+                           uBlock, fMaxErr);
+                }
+            }
+        }
+    }
+
+    printf("Regression: %d of %d checks failed (tolerance %.1e)\n", iFailures, iChecks, fTolerance);
+
+cleanup:
+    free(pXnL);
+    free(pXnR);
+    free(pOutL);
+    free(pOutR);
+    free(pGolden);
+    return iFailures;
+}
+
+// ==================== Fingerprints ====================
+
+/**
+ * Per-segment fingerprint of one channel
+ * @param pXn - First sample of the channel
+ * @param uStride - Distance between samples, 2 for interleaved golden files
+ * @param pPrint - Receives { L2 norm, probe projection } per segment
+ */
+static void FxRegressionSegmentPrints(const float *pXn, uint32_t uStride, double pPrint[FX_REGRESSION_NUM_SEGMENTS][2]) {
+    uint32_t uSeed = FX_REGRESSION_PROBE_SEED;
+    uint32_t uSeg, i;
+
+    for (uSeg = 0; uSeg < FX_REGRESSION_NUM_SEGMENTS; uSeg++) {
+        double fNorm = 0.0, fProj = 0.0;
+        for (i = 0; i < FX_REGRESSION_SEGMENT_SAMPLES; i++) {
+            double fX = pXn[(uSeg * FX_REGRESSION_SEGMENT_SAMPLES + i) * uStride];
+            fNorm += fX * fX;
+            fProj += fX * FxRegressionNoise(&uSeed);
+        }
+        pPrint[uSeg][0] = sqrt(fNorm);
+        pPrint[uSeg][1] = fProj;
+    }
+}
+
+/**
+ * Print effect_regression_golden.h for the golden files in a directory
+ * @param pDir - Directory written by FxRegressionRecord
+ * @return Number of golden files that could not be read
+ */
+int FxRegressionFingerprint(const char *pDir) {
+    uint32_t uSize = FX_REGRESSION_NUM_SAMPLES;
+    float *pGolden = (float *)malloc(2 * uSize * sizeof(float));
+    static double Prints[2][FX_REGRESSION_NUM_SEGMENTS][2];
+    int iEffect, iSignal, iChannel, iFailures = 0;
+    uint32_t uSeg;
+    char Path[512];
+
+    if (!pGolden) {
+        printf("Regression: out of memory\n");
+        return 1;
+    }
+
+    printf("// effect_regression_golden.h - PC Platform Version\n");
+    printf("// Generated by `fx_regression fingerprint <dir>` from recorded goldens. Regenerate only\n");
+    printf("// when an output change is intended.\n");
+    printf("#ifndef __EFFECT_REGRESSION_GOLDEN_H__\n#define __EFFECT_REGRESSION_GOLDEN_H__\n\n");
+    printf("// [effect][signal][segment][channel] = { L2 norm, probe projection }\n");
+    printf("static const double FxRegressionGolden[FX_REGRESSION_EFFECT_COUNT][FX_REGRESSION_SIGNAL_COUNT]\n");
+    printf("                                      [FX_REGRESSION_NUM_SEGMENTS][2][2] = {\n");
+
+    for (iEffect = 0; iEffect < FX_REGRESSION_EFFECT_COUNT; iEffect++) {
+        printf("    {   // %s\n", FxRegressionEffectName((FxRegressionEffect)iEffect));
+        for (iSignal = 0; iSignal < FX_REGRESSION_SIGNAL_COUNT; iSignal++) {
+            FILE *pFp;
+            size_t uRead = 0;
+
+            FxRegressionGoldenPath(Path, sizeof(Path), pDir, (FxRegressionEffect)iEffect, (FxRegressionSignal)iSignal);
+            pFp = fopen(Path, "rb");
+            if (pFp) {
+                uRead = fread(pGolden, sizeof(float), 2 * uSize, pFp);
+                fclose(pFp);
+            }
+            if (uRead != 2 * uSize) {
+                fprintf(stderr, "Regression: missing or short golden %s\n", Path);
+                memset(pGolden, 0, 2 * uSize * sizeof(float));
+                iFailures++;
+            }
+
+            for (iChannel = 0; iChannel < 2; iChannel++)
+                FxRegressionSegmentPrints(pGolden + iChannel, 2, Prints[iChannel]);
+
+            printf("        {   // %s\n", FxRegressionSignalName((FxRegressionSignal)iSignal));
+            for (uSeg = 0; uSeg < FX_REGRESSION_NUM_SEGMENTS; uSeg++)
+                printf("            { { %.17g, %.17g }, { %.17g, %.17g } },\n",
+                       Prints[0][uSeg][0], Prints[0][uSeg][1], Prints[1][uSeg][0], Prints[1][uSeg][1]);
+            printf("        },\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n#endif // __EFFECT_REGRESSION_GOLDEN_H__\n");
+
+    free(pGolden);
+    return iFailures;
+}
+
+/**
+ * Compare the per-sample API and every block size against the committed fingerprints.
+ * The bounds are what a per-sample error of fTolerance can move a segment's norm
+ * (tolerance * sqrt(n)) and projection (tolerance * n), so they never fail a render
+ * that FxRegressionCheck would pass.
+ * @param fTolerance - Max absolute error per sample
+ * @param pEffect - Name of the only effect to verify, NULL for all
+ * @return Number of failed comparisons
+ */
+int FxRegressionVerify(float fTolerance, const char *pEffect) {
+    uint32_t uSize = FX_REGRESSION_NUM_SAMPLES;
+    float *pXnL  = (float *)malloc(uSize * sizeof(float));
+    float *pXnR  = (float *)malloc(uSize * sizeof(float));
+    float *pOutL = (float *)malloc(uSize * sizeof(float));
+    float *pOutR = (float *)malloc(uSize * sizeof(float));
+    static double Prints[2][FX_REGRESSION_NUM_SEGMENTS][2];
+    const double fNormSlack = fTolerance * sqrt((double)FX_REGRESSION_SEGMENT_SAMPLES);
+    const double fProjSlack = fTolerance * (double)FX_REGRESSION_SEGMENT_SAMPLES;
+    int iEffect, iSignal, iFailures = 0, iChecks = 0;
+
+    if (!pXnL || !pXnR || !pOutL || !pOutR) {
+        printf("Regression: out of memory\n");
+        iFailures = 1;
+        goto cleanup;
+    }
+
+    for (iSignal = 0; iSignal < FX_REGRESSION_SIGNAL_COUNT; iSignal++) {
+        FxRegressionMakeSignal((FxRegressionSignal)iSignal, pXnL, pXnR, uSize);
+
+        for (iEffect = 0; iEffect < FX_REGRESSION_EFFECT_COUNT; iEffect++) {
+            FxRegressionEffect eEffect = (FxRegressionEffect)iEffect;
+            uint32_t uBlock;
+
+            if (pEffect && strcmp(pEffect, FxRegressionEffectName(eEffect)) != 0)
+                continue;
+
+            for (uBlock = 0; uBlock <= FX_REGRESSION_BLOCK_MAX;
+                 uBlock = (uBlock == 0) ? FX_REGRESSION_BLOCK_MIN : uBlock * 2) {
+                uint32_t uSeg, uFirst = FX_REGRESSION_NUM_SEGMENTS;
+                double fWorst = 0.0;
+                int iChannel;
+
+                if (uBlock != 0 && !FxRegressionHasBlockApi(eEffect))
+                    break;
+
+                FxRegressionRender(eEffect, pXnL, pXnR, pOutL, pOutR, uSize, uBlock);
+                FxRegressionSegmentPrints(pOutL, 1, Prints[0]);
+                FxRegressionSegmentPrints(pOutR, 1, Prints[1]);
+                iChecks++;
+
+                // Error as a fraction of the allowed slack; a relative 1e-9 absorbs summation rounding
+                for (uSeg = 0; uSeg < FX_REGRESSION_NUM_SEGMENTS; uSeg++) {
+                    for (iChannel = 0; iChannel < 2; iChannel++) {
+                        const double *pGold = FxRegressionGolden[iEffect][iSignal][uSeg][iChannel];
+                        double fRound = 1.0e-9 * pGold[0] * sqrt((double)FX_REGRESSION_SEGMENT_SAMPLES) + 1.0e-12;
+                        double fNormErr = fabs(Prints[iChannel][uSeg][0] - pGold[0]) / (fNormSlack + fRound);
+                        double fProjErr = fabs(Prints[iChannel][uSeg][1] - pGold[1]) / (fProjSlack + fRound);
+                        double fErr = MAX(fNormErr, fProjErr);
+                        // A NaN never compares greater, treat it as an unbounded error
+                        if (fErr != fErr) fErr = INFINITY;
+                        if (fErr > 1.0 && uFirst == FX_REGRESSION_NUM_SEGMENTS) uFirst = uSeg;
+                        fWorst = MAX(fWorst, fErr);
+                    }
+                }
+
+                if (uFirst < FX_REGRESSION_NUM_SEGMENTS) {
+                    printf("FAIL %-10s %-8s block %4u: %.2fx the allowed error, first in segment %u\n",
+                           FxRegressionEffectName(eEffect), FxRegressionSignalName((FxRegressionSignal)iSignal),
+                           uBlock, fWorst, uFirst);
+                    iFailures++;
+                } else {
+                    printf("ok   %-10s %-8s block %4u: %.2fx the allowed error\n",
+                           FxRegressionEffectName(eEffect), FxRegressionSignalName((FxRegressionSignal)iSignal),
+                           uBlock, fWorst);
+                }
+            }
+        }
+    }
+
+    if (iChecks == 0) {
+        printf("Regression: no effect named %s\n", pEffect);
+        iFailures = 1;
+    }
+    printf("Regression: %d of %d fingerprint checks failed (tolerance %.1e)\n", iFailures, iChecks, fTolerance);
+
+cleanup:
+    free(pXnL);
+    free(pXnR);
+    free(pOutL);
+    free(pOutR);
+    return iFailures;
+}
+
+// ==================== Benchmark ====================
+
+/**
+ * Print ns/sample for every effect, per-sample API and each block size
+ */
+void FxRegressionBenchmark(void) {
+    uint32_t uSize = FX_REGRESSION_BENCH_SAMPLES;
+    float *pXnL  = (float *)malloc(uSize * sizeof(float));
+    float *pXnR  = (float *)malloc(uSize * sizeof(float));
+    float *pOutL = (float *)malloc(uSize * sizeof(float));
+    float *pOutR = (float *)malloc(uSize * sizeof(float));
+    int iEffect, iRun;
+
+    if (!pXnL || !pXnR || !pOutL || !pOutR) {
+        printf("Regression: out of memory\n");
+        goto cleanup;
+    }
+
+    FxRegressionMakeSignal(FX_REGRESSION_SIGNAL_NOISE, pXnL, pXnR, uSize);
+    printf("Benchmark: %u stereo samples at %.0f Hz, best of %d\n",
+           uSize, FX_REGRESSION_SAMPLE_RATE, FX_REGRESSION_BENCH_RUNS);
+
+    for (iEffect = 0; iEffect < FX_REGRESSION_EFFECT_COUNT; iEffect++) {
+        FxRegressionEffect eEffect = (FxRegressionEffect)iEffect;
+        uint32_t uBlock;
+
+        for (uBlock = 0; uBlock <= FX_REGRESSION_BLOCK_MAX;
+             uBlock = (uBlock == 0) ? FX_REGRESSION_BLOCK_MIN : uBlock * 2) {
+            double fBest = 1.0e30;
+
+            if (uBlock != 0 && !FxRegressionHasBlockApi(eEffect))
+                break;
+
+            for (iRun = 0; iRun < FX_REGRESSION_BENCH_RUNS; iRun++) {
+                double fStart = FxRegressionNowNs();
+                FxRegressionRender(eEffect, pXnL, pXnR, pOutL, pOutR, uSize, uBlock);
+                fBest = MIN(fBest, FxRegressionNowNs() - fStart);
+            }
+
+            if (uBlock == 0)
+                printf("  %-10s per-sample : %8.2f ns/sample\n", FxRegressionEffectName(eEffect), fBest / uSize);
+            else
+                printf("  %-10s block %4u : %8.2f ns/sample\n", FxRegressionEffectName(eEffect), uBlock, fBest / uSize);
+        }
+    }
+
+cleanup:
+    free(pXnL);
+    free(pXnR);
+    free(pOutL);
+    free(pOutR);
+}
+
+// ==================== Standalone Entry ====================
+#ifdef FX_REGRESSION_MAIN
+int main(int argc, char **argv) {
+    if (argc >= 3 && strcmp(argv[1], "record") == 0)
+        return FxRegressionRecord(argv[2]) == 0 ? 0 : 1;
+
+    if (argc >= 3 && strcmp(argv[1], "check") == 0)
+        return FxRegressionCheck(argv[2], argc >= 4 ? (float)atof(argv[3]) : FX_REGRESSION_TOLERANCE) == 0 ? 0 : 1;
+
+    if (argc >= 3 && strcmp(argv[1], "fingerprint") == 0)
+        return FxRegressionFingerprint(argv[2]) == 0 ? 0 : 1;
+
+    if (argc >= 2 && strcmp(argv[1], "verify") == 0)
+        return FxRegressionVerify(argc >= 3 ? (float)atof(argv[2]) : FX_REGRESSION_TOLERANCE,
+                                  argc >= 4 ? argv[3] : NULL) == 0 ? 0 : 1;
+
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        FxRegressionBenchmark();
+        return 0;
+    }
+
+    printf("Usage: %s record <dir> | check <dir> [tolerance] | fingerprint <dir> | verify [tolerance] [effect] | bench\n", argv[0]);
+    return 2;
+}
+#endif
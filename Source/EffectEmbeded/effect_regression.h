@@ -0,0 +1,76 @@
+// effect_regression.h - PC Platform Version
+#ifndef __EFFECT_REGRESSION_H__
+#define __EFFECT_REGRESSION_H__
+
+#include <stdint.h>
+
+// ==================== Basic Definitions ====================
+// Render settings shared by the golden files and the benchmark
+#define FX_REGRESSION_SAMPLE_RATE       48000.0f
+#define FX_REGRESSION_NUM_SAMPLES       96000           // 2s golden render
+#define FX_REGRESSION_BENCH_SAMPLES     480000          // 10s per measurement
+#define FX_REGRESSION_BENCH_RUNS        3               // Best of N
+
+// Block sizes exercised by the check and the benchmark (powers of two)
+#define FX_REGRESSION_BLOCK_MIN         16
+#define FX_REGRESSION_BLOCK_MAX         4096
+
+// Default max absolute error against the golden output
+#define FX_REGRESSION_TOLERANCE         1.0e-5f
+
+// Committed fingerprints (effect_regression_golden.h): per segment and channel, the L2 norm
+// and the projection onto a fixed noise probe
+#define FX_REGRESSION_SEGMENT_SAMPLES   4000
+#define FX_REGRESSION_NUM_SEGMENTS      (FX_REGRESSION_NUM_SAMPLES / FX_REGRESSION_SEGMENT_SAMPLES)
+#define FX_REGRESSION_PROBE_SEED        0x2545F491u
+
+// Test Signals
+#define FX_REGRESSION_SWEEP_START_HZ    20.0f
+#define FX_REGRESSION_SWEEP_END_HZ      20000.0f
+#define FX_REGRESSION_SIGNAL_LEVEL      0.5f
+
+typedef enum
+{
+    FX_REGRESSION_SIGNAL_IMPULSE = 0,
+    FX_REGRESSION_SIGNAL_NOISE,
+    FX_REGRESSION_SIGNAL_SWEEP,
+    FX_REGRESSION_SIGNAL_COUNT
+} FxRegressionSignal;
+
+typedef enum
+{
+    FX_REGRESSION_EFFECT_DELAY = 0,
+    FX_REGRESSION_EFFECT_CATHEDRAL_REVB,
+    FX_REGRESSION_EFFECT_FLANGER,
+    FX_REGRESSION_EFFECT_PLATE_REVB,
+    FX_REGRESSION_EFFECT_PITCH,
+    FX_REGRESSION_EFFECT_COUNT
+} FxRegressionEffect;
+
+// ==================== Function Declarations ====================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const char *FxRegressionEffectName(FxRegressionEffect eEffect);
+const char *FxRegressionSignalName(FxRegressionSignal eSignal);
+int  FxRegressionHasBlockApi(FxRegressionEffect eEffect);
+
+void FxRegressionMakeSignal(FxRegressionSignal eSignal, float *pXnL, float *pXnR, uint32_t uNumSamples);
+void FxRegressionRender(FxRegressionEffect eEffect, const float *pXnL, const float *pXnR,
+                        float *pOutL, float *pOutR, uint32_t uNumSamples, uint32_t uBlockSize);
+
+// Golden files: <dir>/<effect>_<signal>.f32, interleaved stereo float32
+int  FxRegressionRecord(const char *pDir);
+int  FxRegressionCheck(const char *pDir, float fTolerance);
+
+// Fingerprints: print effect_regression_golden.h from golden files, or check against the committed one
+int  FxRegressionFingerprint(const char *pDir);
+int  FxRegressionVerify(float fTolerance, const char *pEffect);   // pEffect: one effect's name, NULL for all
+void FxRegressionBenchmark(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __EFFECT_REGRESSION_H__
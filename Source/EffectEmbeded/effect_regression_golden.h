@@ -0,0 +1,412 @@
+// effect_regression_golden.h - PC Platform Version
+// Generated by `fx_regression fingerprint <dir>` from recorded goldens. Regenerate only
+// when an output change is intended.
+#ifndef __EFFECT_REGRESSION_GOLDEN_H__
+#define __EFFECT_REGRESSION_GOLDEN_H__
+
+// [effect][signal][segment][channel] = { L2 norm, probe projection }
+static const double FxRegressionGolden[FX_REGRESSION_EFFECT_COUNT][FX_REGRESSION_SIGNAL_COUNT]
+                                      [FX_REGRESSION_NUM_SEGMENTS][2][2] = {
+    {   // delay
+        {   // impulse
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0.70699578523635864, 0.67462475417088541 }, { 0.70699578523635864, 0.24597384424769686 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0.35348525643348694, -0.14173521766961716 }, { 0.35348525643348694, 0.068513434078700808 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0.17673631012439728, -0.04942825997102096 }, { 0.17673631012439728, 0.14902907596454629 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0.088364996016025543, -0.058876164121663077 }, { 0.088364996016025543, 0.044116797896605497 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+        },
+        {   // noise
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 10.976509037946407, -1.5650594256852703 }, { 10.840021613446357, 3.8748465092373836 } },
+            { { 12.943096745808495, -13.518032020706329 }, { 12.825022923458716, -3.1606200084859548 } },
+            { { 12.865752063154376, 5.3213532961127443 }, { 13.023328387317244, -2.1399152956086764 } },
+            { { 13.004527256469688, 3.6483115470490222 }, { 12.833419769330948, -6.2472821466769632 } },
+            { { 12.805102512926211, -1.6715969023040811 }, { 12.982710136747787, 14.178097233040086 } },
+            { { 13.650019662465729, -2.984127220625592 }, { 13.545493038103876, -4.8070233039876635 } },
+            { { 14.428535415261562, -8.9114708121075061 }, { 14.438232366307865, -0.20635798367847313 } },
+            { { 14.474089443586379, 0.93972090476015802 }, { 14.594304710949736, 2.8571405396697354 } },
+            { { 14.433884164794094, 9.1825231680223567 }, { 14.578200764977073, 4.1558348488153047 } },
+            { { 14.404766025777768, -4.5433423863433315 }, { 14.364703489511193, 14.193028213288772 } },
+            { { 14.417503777035336, -0.30312548633861802 }, { 14.884384892876247, -3.7941850842687126 } },
+            { { 14.969573640778268, 7.8203485989694919 }, { 14.696350370014686, -10.646500788746003 } },
+            { { 14.692754057587596, -9.3348203912904442 }, { 14.763819278249075, -11.17378512351392 } },
+            { { 14.780017158065528, 5.7518299369001209 }, { 14.778434788185463, -6.5563685349435552 } },
+            { { 14.444924765610377, 0.76891628971914039 }, { 14.997170258188508, -0.066614895390174844 } },
+            { { 14.774881426128108, -13.062722325922081 }, { 14.772802763054653, 13.253711266260215 } },
+            { { 14.969027069686421, 11.697377098425129 }, { 15.009085489493261, -7.5601634112634732 } },
+            { { 14.686627541246269, -10.138104580710193 }, { 15.106229969309185, 5.4791069490255166 } },
+            { { 15.002889335375132, -21.097584375400182 }, { 14.89632545553903, -1.2982041530213584 } },
+        },
+        {   // sweep
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 13.71423436025775, 0.11502823088417269 }, { 13.107508628905022, 3.3272405904672375 } },
+            { { 15.42586970047428, 2.8968276413705061 }, { 16.182880111590837, -5.3196888752775333 } },
+            { { 16.093681587720067, 5.1450251672366427 }, { 15.518907064861034, 2.1517784720983855 } },
+            { { 15.509589145901675, -12.562078276425938 }, { 16.102661509645401, 3.9995499041893758 } },
+            { { 15.915994851068103, 7.2598314049824335 }, { 15.701088268370695, -12.44323838886147 } },
+            { { 16.777380817867812, -1.453247654871493 }, { 16.960975149995235, 3.7081103844500998 } },
+            { { 17.703856937709304, 12.23121443943641 }, { 17.817104392211416, -0.15815414573110215 } },
+            { { 17.524375192009487, 8.5534683046702913 }, { 17.396077349979304, 3.0895287008589185 } },
+            { { 17.685577526855276, -11.680464613818557 }, { 17.735496677484289, 2.739875311401359 } },
+            { { 17.754086308236449, 2.1903233813922589 }, { 17.811884414317632, 6.8966487648312098 } },
+            { { 17.710650748726898, -7.6164736743539674 }, { 17.618680501102826, -15.184387157301643 } },
+            { { 18.067642293771392, -5.9992533913328305 }, { 18.186300809429937, 17.866740576063467 } },
+            { { 18.192944945694816, -7.6353091281345433 }, { 18.104112303678818, 2.9174281244467073 } },
+            { { 18.101319570388153, -8.0849690335252102 }, { 18.127169875298474, -3.0037886117191008 } },
+            { { 18.128801401478551, 5.8464488114237199 }, { 18.093748343453576, -2.5482043249534883 } },
+            { { 18.11956327490778, -4.1579746656783936 }, { 18.12909185185082, 16.207110682855294 } },
+            { { 18.177823534546146, -2.3228176703666557 }, { 18.190812287599069, -0.62316046556545357 } },
+            { { 18.232984896836882, 1.337399186785561 }, { 18.239089659054894, 1.9901738412624954 } },
+            { { 18.216681629766658, 9.438920068078831 }, { 18.208958103968307, -11.208180179430052 } },
+        },
+    },
+    {   // cathedral
+        {   // impulse
+            { { 0.053372603880963078, -0.029957061220429342 }, { 0.05956086343232752, -0.045188992648942258 } },
+            { { 0.057442635991194917, 0.011822162084097459 }, { 0.054856206421048284, -0.0060804611704305955 } },
+            { { 0.046458506065472666, -0.016379454174819633 }, { 0.050303936976467178, 0.03166941516745661 } },
+            { { 0.040297154776519066, -0.039653738558454714 }, { 0.040205195658271638, -0.049292229616579426 } },
+            { { 0.03501105739249958, -0.0058716550618905889 }, { 0.033565399531683651, -0.025392018412077295 } },
+            { { 0.03051061175861261, -0.013697263398531567 }, { 0.028323905892618274, 0.0067953903302035712 } },
+            { { 0.026331552672898287, -0.013033861537327837 }, { 0.026228732658076001, 0.0040583295932677104 } },
+            { { 0.023628506748351437, -0.0023283632723331664 }, { 0.022312324679492682, 0.010512863153395802 } },
+            { { 0.021320188688972508, 0.01756853563720585 }, { 0.020252871987742525, 0.0081270324611672738 } },
+            { { 0.018250006198773153, 0.01298799378434431 }, { 0.017879959326414813, 0.0076757961782153838 } },
+            { { 0.016721596180659569, -0.0069957408245629165 }, { 0.016493303319816129, 0.020797737642257216 } },
+            { { 0.015480846866349939, -0.0050563295924789175 }, { 0.016083405531194646, 0.0034197721348853869 } },
+            { { 0.01460319079459072, -0.006829930227883336 }, { 0.012970708906146898, 0.0039299005955390712 } },
+            { { 0.012439212569145756, -0.004965659909175732 }, { 0.012352176102176057, 0.0044067922192820739 } },
+            { { 0.011119033102619989, -0.0033895613677973305 }, { 0.011001414956794608, -0.010930170259882608 } },
+            { { 0.010380264638902185, -0.0032359455621912615 }, { 0.0098070739769861859, -0.0063183731873305005 } },
+            { { 0.0096940805380252779, 0.0089037646509255355 }, { 0.010046740171064069, -0.0048490212244070487 } },
+            { { 0.0084754599951446935, 0.0068900774800155114 }, { 0.0079372424189911427, 0.00054069969062770298 } },
+            { { 0.0077520290785185984, -0.0068598544601275058 }, { 0.0074677631476582377, -0.012143468803028789 } },
+            { { 0.0074773116806497548, -0.00063140539491598894 }, { 0.0073036501073300069, -0.0030862345146913097 } },
+            { { 0.0062520329864641459, 0.0039556909440104614 }, { 0.0064604241681386473, 0.0034041261379770408 } },
+            { { 0.0062463394428004648, -0.00092663627761472352 }, { 0.0063163807706362604, 0.0031964334124651812 } },
+            { { 0.0052825512823890582, 0.0018894578193665752 }, { 0.0055651771509824957, 0.0025584407820587185 } },
+            { { 0.0050889803872994719, 0.00025321721931725785 }, { 0.0047445519974676879, -0.003509545428024586 } },
+        },
+        {   // noise
+            { { 0.56019412999483675, -0.11777211900103576 }, { 0.60719412848248544, 0.070441884356407775 } },
+            { { 1.2483664015412299, 0.66112724462294192 }, { 1.2781011944284006, 0.69033918238338587 } },
+            { { 1.5949076708742731, 0.64154575140901282 }, { 1.637871941229637, -0.4557887399954369 } },
+            { { 1.7478789808054038, 0.3128132896117648 }, { 1.8145269868666314, -0.77062443006491321 } },
+            { { 1.8740577381697581, 0.77927292014038319 }, { 1.9064279334220657, -0.81050558340973233 } },
+            { { 1.9494479111940746, 1.6867820326250731 }, { 2.020929057260227, -0.15896778143103441 } },
+            { { 2.034164273807165, 0.16987356309679344 }, { 2.0270342706444016, -0.092755402135020204 } },
+            { { 2.1374224152912542, 2.2219443634053273 }, { 2.111621694054572, -0.77333160334343221 } },
+            { { 2.0895442784390923, 1.5379361268415881 }, { 2.110716448373692, -0.71065039795133622 } },
+            { { 2.1935081847385218, -1.2651256778264917 }, { 2.1842664797364484, -0.81544497132788774 } },
+            { { 2.2548389119259715, -0.64337269534652575 }, { 2.2140121368873853, 0.74570174178753079 } },
+            { { 2.2762702477777057, -0.88672864547747143 }, { 2.25486183710832, 0.077471014743690725 } },
+            { { 2.2450406470524142, -0.36815992205289216 }, { 2.2711260352434222, 1.7633142791388319 } },
+            { { 2.2041994117533967, 0.69187266658559532 }, { 2.2384654874941265, -0.27482223251328886 } },
+            { { 2.2056907140657742, 0.0093289236798217365 }, { 2.2698949714372381, 1.5735858123164046 } },
+            { { 2.2874313738681478, 0.61970164727826949 }, { 2.3109618487330312, -0.68342984732499401 } },
+            { { 2.2112208235405069, -1.3650901764487133 }, { 2.319768028744043, -2.6137432949208725 } },
+            { { 2.2008950116262938, 2.5983873264982642 }, { 2.2963993237749718, -2.1747605179426333 } },
+            { { 2.2026138984132855, -1.0537532710243505 }, { 2.2983243307871208, 0.92025629932112918 } },
+            { { 2.2225691642378593, -0.029873735697051845 }, { 2.3664224275548298, -0.77026882245529471 } },
+            { { 2.2741950519950835, 0.55376086423908655 }, { 2.2442299712092337, 1.4499928605930967 } },
+            { { 2.2202369824277803, -1.4710119536525141 }, { 2.3676770222265815, -1.9741898306414571 } },
+            { { 2.2378797416983676, -1.721827990598525 }, { 2.2666707752050343, -0.85072756738119804 } },
+            { { 2.3037188709041563, 0.26814240786532789 }, { 2.2747030441311358, 0.0037205175837815019 } },
+        },
+        {   // sweep
+            { { 0.300071878630289, -0.027585787472954058 }, { 0.38198931124329438, -0.28314221265523332 } },
+            { { 0.69784438519860825, -0.72529973936313474 }, { 0.50140940590236638, 0.30580969509079098 } },
+            { { 1.1137944115945668, -0.80570974139275342 }, { 0.52047458140871483, -0.60434399439637165 } },
+            { { 0.79633179118012576, 0.98532479172246912 }, { 0.82757102437951746, 0.6228611502739293 } },
+            { { 1.5078988881113802, -1.1421738186974246 }, { 1.8979657451951326, -0.063213076697411483 } },
+            { { 2.6838437169076919, -0.70357569504348749 }, { 1.8837484221331049, -0.48073548649957554 } },
+            { { 2.2886424639945875, 0.71957469885712977 }, { 3.1314752461022088, -0.48428502105471072 } },
+            { { 3.6558616255284271, -0.025925411531879092 }, { 3.6422425592146896, -2.0145372024190191 } },
+            { { 4.0295050778455233, 2.7533889782349923 }, { 3.3860532434625741, 0.61277235243538275 } },
+            { { 4.1214816615240233, 1.3264635123406037 }, { 4.4893793411449598, -4.2640442613485536 } },
+            { { 4.5971361817758609, 1.7628462864544441 }, { 4.7457624491616146, 0.28561955758935365 } },
+            { { 6.059098132337323, -1.0671401194794183 }, { 6.4671915085754756, 2.3278961748887053 } },
+            { { 5.8030462947523516, -3.3473049068960883 }, { 6.8881962940705375, 0.3055267952204091 } },
+            { { 6.7435615816813126, -4.7861475694218036 }, { 6.3786599679392779, -2.2006362171678875 } },
+            { { 6.9434168728392525, -0.16271180105170976 }, { 6.6900572920893904, 2.0032610750386595 } },
+            { { 6.9735820079148185, -1.729495533598739 }, { 7.0837637722837963, -5.7433443480526254 } },
+            { { 7.1095745363503378, 0.74829480939627435 }, { 7.1301258610519804, -4.7462433793581367 } },
+            { { 6.8951727106204368, 2.6129331846215322 }, { 6.8304004893812333, 0.92230211375198401 } },
+            { { 6.4736761423983085, 0.67190141071056619 }, { 6.4674849398431871, -0.65702357585838445 } },
+            { { 5.8719041317203491, 4.007382869549204 }, { 6.1800030906624999, -1.2574886910826821 } },
+            { { 5.773194666489295, 1.4160064712324947 }, { 5.6846458571597527, 1.3852372684230227 } },
+            { { 5.0113637632083652, 3.2295833452431149 }, { 4.9443322678248176, -3.2924640202340347 } },
+            { { 5.2067639331114393, -3.2351878633633886 }, { 4.7659766615330899, 3.3744470290581488 } },
+            { { 4.2674817930305364, 1.5671093435596131 }, { 4.3688408456831986, 1.3156975013650414 } },
+        },
+    },
+    {   // flanger
+        {   // impulse
+            { { 0.72300681816425216, -0.55937694290576534 }, { 0.71452249218941954, -0.27544677424226832 } },
+            { { 1.6903047649939672e-05, 5.0909630077408932e-06 }, { 4.7587854304728143e-12, 2.6124224260961356e-12 } },
+            { { 3.4934328413829457e-14, 1.3803022216010226e-14 }, { 8.5277443602553625e-30, -2.6559238490620056e-30 } },
+            { { 1.1245297947590459e-33, 7.2363349385694432e-34 }, { 3.3718107660308638e-35, 3.092900579596096e-35 } },
+            { { 6.0788390881580941e-40, 3.7632878265610359e-40 }, { 9.0273297575536877e-39, 1.2093153786982031e-40 } },
+            { { 1.3829616097636239e-43, 3.1792936715150799e-44 }, { 3.2533068578266483e-44, 3.507186365686367e-44 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+        },
+        {   // noise
+            { { 12.305243758917939, -2.3279245616890436 }, { 12.626359817082861, -4.8569662451186169 } },
+            { { 12.592909999557556, -7.8673966184061133 }, { 12.404074894379884, 2.8346819242904218 } },
+            { { 12.701792077431282, -4.0794447904981057 }, { 12.820906475197365, -11.503560389856348 } },
+            { { 12.700874374866794, -6.3188670556350575 }, { 12.78199480703605, 5.2568404817183243 } },
+            { { 12.656458482604405, -7.3813017868777671 }, { 12.425864423590063, -2.7517006248412219 } },
+            { { 12.812460692694648, -1.8696969286919818 }, { 12.994884895068385, -13.463355222138748 } },
+            { { 12.752819290480156, -9.8158224671491219 }, { 12.911056523470263, 2.442384640254549 } },
+            { { 12.582259610537351, -0.12105038470400054 }, { 12.790493796221014, 5.2888364613905221 } },
+            { { 12.753763749275038, -7.9395330919705707 }, { 12.582616883482656, -7.140938520343278 } },
+            { { 12.681501232525914, -3.9139394777208332 }, { 12.643117512167382, -9.9928132658097777 } },
+            { { 12.718524909529485, -1.5274314636964617 }, { 12.908854500092069, 12.505181694393116 } },
+            { { 12.592883933744133, -9.3880080784738915 }, { 12.684149944872335, -7.130773316484011 } },
+            { { 12.880226262448835, 6.0010226882622097 }, { 12.850833274219209, 3.5082126853406468 } },
+            { { 12.542505954196868, 20.11069413398976 }, { 12.966350688351834, 0.080436773959132069 } },
+            { { 12.925266507694078, -5.7354817232201789 }, { 12.888002721361451, 1.7385170495518687 } },
+            { { 12.592649457438911, 4.3657223868793746 }, { 12.496283175938519, -4.572609777646254 } },
+            { { 12.383716333721146, -7.1853688405409253 }, { 12.815827203761373, -1.947665246135369 } },
+            { { 12.588046299364768, 3.0846059593407009 }, { 12.859911060356472, 6.4839232340507218 } },
+            { { 12.724375367308436, -0.54694924955516555 }, { 12.747962054874415, 4.6376626751457692 } },
+            { { 12.605629282593171, -9.4799389836125147 }, { 12.273263813533923, 8.1658033325872754 } },
+            { { 12.667752727992752, -6.8904261203574322 }, { 12.808005817315946, -9.8737125877081695 } },
+            { { 12.882230301199035, -1.6965575959529655 }, { 12.908588118667325, -1.1470421224728284 } },
+            { { 12.289065190830776, -8.4933458061050722 }, { 12.580863987122635, 1.0903704260554616 } },
+            { { 13.132059315320598, -12.840396941347599 }, { 12.896310654898498, -3.2884151115230504 } },
+        },
+        {   // sweep
+            { { 24.083544014244186, 13.557771958608681 }, { 31.727202359413216, -2.2232823577697589 } },
+            { { 28.639365432364993, 24.713638449006858 }, { 35.528303773754999, -5.695683457591481 } },
+            { { 34.048922439555795, -6.6318003146092348 }, { 20.457367402886383, -4.4866137084242936 } },
+            { { 17.433348954272279, 7.3402571468977085 }, { 8.970071633298728, 2.4910650485627408 } },
+            { { 6.2181940601231105, -0.78573005661938722 }, { 9.8661955520987714, -13.109886357724434 } },
+            { { 5.5400689083861208, -2.0499441991665588 }, { 20.870729669032475, -14.260259711284528 } },
+            { { 12.385033631404522, -5.7377218754896395 }, { 14.962461399577352, -7.2098077003210301 } },
+            { { 15.422837377101642, -5.1995459955696841 }, { 13.633642260799258, 3.3248845189264657 } },
+            { { 19.640589618525553, 5.7595985670260985 }, { 20.026023189114198, -24.050247085880606 } },
+            { { 7.6195081512080636, -2.6760244663334003 }, { 26.955143490022259, -23.296301581945364 } },
+            { { 7.456227668714809, -0.84590938745176869 }, { 6.687918784149919, 5.4295390518653583 } },
+            { { 18.847108587112547, 15.196020761557678 }, { 18.636624586352514, -6.3858350373446999 } },
+            { { 17.883561451975591, -2.2914656465601837 }, { 17.209210269151672, 8.8065549414294839 } },
+            { { 17.42442259217545, 0.54406822069032124 }, { 11.914128759025761, 5.382777120784044 } },
+            { { 13.61669817892024, 1.0677350560934162 }, { 18.763917126662047, -9.9182507542799385 } },
+            { { 19.681490600475055, -3.9144809152226165 }, { 19.752540051158856, 0.67458477552896623 } },
+            { { 16.305530337397428, -4.0775087778586494 }, { 17.639272170998513, -8.9202660386522599 } },
+            { { 17.617299981539411, -2.4651900671048192 }, { 19.410054404688363, 10.008910107931445 } },
+            { { 17.4315772135384, -7.6866114169880166 }, { 17.683727715283769, -8.0200424415532492 } },
+            { { 17.662110296116804, -1.602134872540897 }, { 17.113953432635171, 10.594661040605679 } },
+            { { 16.771099304281361, -11.650627671980413 }, { 16.654639125388108, 0.81601246205213962 } },
+            { { 16.082991338702527, -3.3944877407981187 }, { 16.108102750853043, -10.06012444112708 } },
+            { { 15.067077939356432, 1.4593000193406125 }, { 15.119085549256161, -3.8361117010539196 } },
+            { { 14.146232140647337, -2.7365656591224381 }, { 13.961212839881068, -6.5710838890003549 } },
+        },
+    },
+    {   // plate
+        {   // impulse
+            { { 0.37385739976469556, -0.06460233240013627 }, { 0.37080655877407953, -0.069387591630080722 } },
+            { { 0.53130903795548834, -0.16246481411642272 }, { 0.50605882081234244, 0.052787815368696686 } },
+            { { 0.38733675537281281, 0.3135648103660168 }, { 0.42363506857542271, -0.23493363267755846 } },
+            { { 0.31923838946701349, 0.10627384920082013 }, { 0.31982242782565934, -0.083564749887978657 } },
+            { { 0.24768062638437868, -0.10715927272639912 }, { 0.24709135274822375, 0.0405402572069197 } },
+            { { 0.22571034599511519, 0.048476402581661596 }, { 0.20227235994062606, -0.13547114278193054 } },
+            { { 0.18530100141863601, -0.013418357874715242 }, { 0.18722477512735261, -0.007082700724509854 } },
+            { { 0.15307579550696118, 0.015532694342408539 }, { 0.15580778389304378, -0.1658420389921581 } },
+            { { 0.12678474060534481, -0.077116180213108232 }, { 0.12107286318056694, -0.054494387796720785 } },
+            { { 0.10566684260913928, -0.037241509375526005 }, { 0.10652990555536823, 0.026047642108927415 } },
+            { { 0.08764392574866374, 0.012160685516224404 }, { 0.090490259975643722, -0.00088569416388943915 } },
+            { { 0.076979405594969491, -0.068371896799339874 }, { 0.076489082065814923, -0.07949965703900283 } },
+            { { 0.066722608077300016, -0.030968202985226519 }, { 0.063192168179142638, 0.004762280080354982 } },
+            { { 0.055760480510853694, -0.023437880355524108 }, { 0.056726444992918075, 0.02499956947230552 } },
+            { { 0.047665013267569507, 0.027993374495398578 }, { 0.045105916115475639, -0.0022436205371347095 } },
+            { { 0.041511511888095327, 0.015907500532707803 }, { 0.039546737863757585, 0.021604784195958703 } },
+            { { 0.035406272851265463, -0.014465972157612729 }, { 0.033975004351740071, -0.01733018895414485 } },
+            { { 0.029235446586737854, 0.019130104448821985 }, { 0.029851036032856226, 0.018073681064233377 } },
+            { { 0.025723791949149814, 0.0014892040631251753 }, { 0.02607300582357136, -0.01173890510785792 } },
+            { { 0.021392578018090917, -0.014239487939891252 }, { 0.021701061149493592, -0.0089518822073368191 } },
+            { { 0.018228696424386973, 0.0036816009591155233 }, { 0.018019354525243312, -6.0664469042947806e-05 } },
+            { { 0.015585944747808573, -0.0045495906662489276 }, { 0.01571159127368137, 0.001595007250579092 } },
+            { { 0.013624793791226541, -0.0035922618867681778 }, { 0.013493601153205652, 0.0015971755947383622 } },
+            { { 0.011972874003165502, 0.00019851594108551574 }, { 0.01179118034109598, -0.0026029443527440161 } },
+        },
+        {   // noise
+            { { 4.2665132080460602, 0.28808128355967583 }, { 4.1825515147802159, -0.59765402834316073 } },
+            { { 9.5283559930258228, -0.72638570551285464 }, { 8.8881907240873304, 3.0785107377224468 } },
+            { { 11.815837541078295, 3.9776995913436037 }, { 11.823286789562417, 0.021186681019717213 } },
+            { { 12.996663445107473, 10.116942054839628 }, { 12.991357964282452, -13.310745764084945 } },
+            { { 13.690638586884928, 8.2211451333389629 }, { 13.646079423860305, -5.823309031217323 } },
+            { { 14.174541748064591, 10.369769098940093 }, { 14.439831408195927, -0.13706180193176976 } },
+            { { 14.540072963002787, -7.5735195028034887 }, { 14.492609741543026, -1.4026129329347223 } },
+            { { 14.764502567615796, -0.9620546144983344 }, { 14.640800921864889, -1.8749934663729566 } },
+            { { 14.897643104754623, -5.7663243274681051 }, { 14.745483832453534, -13.07372649345831 } },
+            { { 14.874457703509334, 4.8468953721369736 }, { 14.728946162002682, -4.34063772832405 } },
+            { { 15.164445814006978, 7.1424087914017029 }, { 15.279594234269942, 1.9352297262739244 } },
+            { { 15.203141225456582, -8.6727650336341533 }, { 14.66669941902788, -6.7979762620609714 } },
+            { { 14.896843857420878, -13.259417413611539 }, { 15.130337359536371, 2.1329968700189079 } },
+            { { 15.135091014450161, 10.950262151546291 }, { 15.020951487701144, 11.099339458416381 } },
+            { { 15.091464363469573, 3.1207511039463953 }, { 15.155590892801738, -6.676490031305681 } },
+            { { 14.96028373193179, -2.7945242667252765 }, { 14.901730725540352, 22.275266289870391 } },
+            { { 15.268641975059598, 11.828452884387007 }, { 15.08256731320755, -15.184511999930562 } },
+            { { 15.126691644172045, 3.2822432368382275 }, { 15.242190559427973, -1.032400426369912 } },
+            { { 15.071760820855362, -2.2618132724605169 }, { 15.10118397647709, 7.5535413638386268 } },
+            { { 15.025960063962756, 1.157544928242956 }, { 15.051370633401682, 11.172254181060136 } },
+            { { 15.267170554816296, -2.1037690269753759 }, { 14.83134955232916, -4.8878857699804703 } },
+            { { 15.074806080925727, -12.969044314782439 }, { 15.538954911350171, 9.2064310879398832 } },
+            { { 14.879858439235182, 1.4760340546304946 }, { 14.690107025594829, -13.250726100995488 } },
+            { { 14.936684639375017, 0.44708139149073467 }, { 14.666781473494872, -7.641080288987034 } },
+        },
+        {   // sweep
+            { { 6.6192814578485617, -1.5298594811738304 }, { 7.5332533382990867, -2.3954995867096804 } },
+            { { 16.791075078517206, 12.269194712270716 }, { 16.816455488884419, 12.295615322346737 } },
+            { { 8.0084632995620826, -2.3099066313996928 }, { 20.191880810373078, -2.8269399362517387 } },
+            { { 24.880896413385965, 28.114452717648149 }, { 16.569639204875163, 4.4479256183574112 } },
+            { { 23.429817257676135, -17.783865136476376 }, { 19.723049436519869, -18.382604054867954 } },
+            { { 23.677432792307584, -23.413629725542418 }, { 24.002269125767462, -2.8596097708369337 } },
+            { { 27.505378794380899, 7.5574912821340119 }, { 19.887964250137976, 5.2751052491447181 } },
+            { { 22.651286681420487, -1.2019062488854133 }, { 28.226445901751248, -21.51741257152834 } },
+            { { 21.127675672292003, 3.1808556873394345 }, { 20.736044773078927, -11.516103917985845 } },
+            { { 28.803029151767632, -35.946088190549929 }, { 24.017503637316192, -10.602925293186937 } },
+            { { 29.371661629957103, -2.3575474612387946 }, { 26.87371296432266, -2.1450829689680613 } },
+            { { 24.937075970885861, 1.7308826343947965 }, { 22.887001278619426, -9.2275527838517348 } },
+            { { 25.975890220819835, -3.0841699883021882 }, { 26.567632750574717, 26.700774776018619 } },
+            { { 25.630743921256901, 3.135430601321175 }, { 25.275458381466702, -6.4077769219684626 } },
+            { { 27.007790358503865, 9.0400432510054962 }, { 25.208242172577208, -24.891257318450375 } },
+            { { 26.350460605913696, -4.5618933154753085 }, { 26.317439838400986, -0.49420341159261083 } },
+            { { 25.648594790806065, 10.436672289887863 }, { 25.441162809559756, -5.0431016041004932 } },
+            { { 25.249083413548, 9.1373315034606737 }, { 25.229226778058177, -17.802849166225954 } },
+            { { 24.967022560504265, 1.4552058791736784 }, { 25.508564180070238, -17.408552145358904 } },
+            { { 25.661678888046726, -23.283673569016752 }, { 25.639245360105225, 3.9760206147414365 } },
+            { { 25.064807802054009, 5.9981233410449226 }, { 25.369459266110493, 5.2034657958123018 } },
+            { { 24.696958646618182, 15.336413177283836 }, { 24.402263790535198, 17.608326000078669 } },
+            { { 23.094420323864924, 34.023739167121953 }, { 23.63049853827869, -7.8674889004489321 } },
+            { { 22.289032110838551, -14.695644649142558 }, { 22.004473840035359, 23.640998602697664 } },
+        },
+    },
+    {   // pitch
+        {   // impulse
+            { { 0.71339691038916664, 0.25872397173518635 }, { 0.76000452294789034, -0.43507833734724777 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+            { { 0, 0 }, { 0, 0 } },
+        },
+        {   // noise
+            { { 10.296735517492943, -6.4739236709662515 }, { 10.197356140128397, -7.8181622291466084 } },
+            { { 12.506200075426209, -2.7756934908758071 }, { 12.140888587384715, 13.554063189070298 } },
+            { { 12.233044240977769, 0.53913872336754931 }, { 12.442148005174696, -8.8996595322460781 } },
+            { { 12.05479165976595, -0.56596605248279097 }, { 11.933912003280152, 0.1163368871291276 } },
+            { { 12.237301480300786, 3.6300588426500222 }, { 12.251090570078995, -20.620738412495996 } },
+            { { 12.348943517316259, -4.1163525602950752 }, { 12.473052117599257, 3.9133080315366979 } },
+            { { 12.22403749353326, 11.429633772529579 }, { 12.333854933787721, 6.9121022502591805 } },
+            { { 11.868751739390142, -5.4720590842362311 }, { 11.938321414164154, -12.061038881048406 } },
+            { { 12.180582883804083, 7.4233450359152613 }, { 12.448078297470069, 4.5498702375848623 } },
+            { { 12.302620722049584, -7.6064059653643987 }, { 12.321972595956714, -8.1053476942188674 } },
+            { { 12.322622520923334, -3.3718683087885108 }, { 12.173513574020344, 5.3345949095644247 } },
+            { { 11.797125388267304, 16.817144916858972 }, { 11.935635584765102, -2.8080802951309649 } },
+            { { 12.432719442606453, -0.13043150386317653 }, { 12.371528759487395, -2.9021354794841132 } },
+            { { 12.122160222580117, -6.7050962573278889 }, { 12.369052196046527, 5.0288548820916157 } },
+            { { 11.870534455869629, -8.450940048820005 }, { 12.037382613885383, 10.676755106601391 } },
+            { { 12.18239232941016, 6.4696372127337911 }, { 12.107262209996245, 10.040551212466344 } },
+            { { 12.389455469488219, 6.306654271988859 }, { 12.457522972795902, 11.163746664923094 } },
+            { { 12.195976178109882, 2.9907631107080612 }, { 12.261230364055299, 10.472355576947262 } },
+            { { 12.042577903688459, 5.7378496424551795 }, { 11.876020568161922, -10.373175347273964 } },
+            { { 12.289451893402548, -6.5459522413376545 }, { 12.17682452586307, -4.7379429285021883 } },
+            { { 12.454317154809889, -0.20224096449688822 }, { 12.320730761253648, 5.7017858904149383 } },
+            { { 11.936677626210487, 2.4272729717313455 }, { 12.060987700428999, 0.67915074599575964 } },
+            { { 11.977918594524686, 1.1070720524415532 }, { 12.215756642291336, 1.4217821379220066 } },
+            { { 12.367228616603564, -5.2620598252068485 }, { 12.324525653601981, -0.21278302885432693 } },
+        },
+        {   // sweep
+            { { 11.708104434061557, 9.105725185734757 }, { 11.389106542192859, 2.849257765553606 } },
+            { { 14.696503959711205, -16.02458482379005 }, { 14.505934995546296, 7.8206240668837532 } },
+            { { 18.65473017295373, 1.5634597777029811 }, { 18.805355449855671, 5.454264731009113 } },
+            { { 21.649488456034678, 3.1379021929615218 }, { 21.614685814236072, 5.2603918227950723 } },
+            { { 15.673403572118833, -1.1304245426898851 }, { 15.423021967799638, -6.5682286181280967 } },
+            { { 19.762910590241514, 19.659268464775007 }, { 19.675631194539875, 3.890761647721078 } },
+            { { 16.802879028577888, -3.3729824097074106 }, { 16.911565024113912, -7.2422514254746915 } },
+            { { 18.039586417304342, -5.7730769868717502 }, { 18.079709092565658, -8.8220427055659076 } },
+            { { 19.067314905209368, 2.824414844076558 }, { 19.045746646403455, -3.0962840810546264 } },
+            { { 18.498831132634457, 10.811145999592528 }, { 18.526859689686951, -13.821251219131174 } },
+            { { 18.008741733030995, 2.9613379249161609 }, { 18.019716120872104, -17.786399904713363 } },
+            { { 18.006265003373692, 14.990005094451501 }, { 18.008065329152714, 8.6047293556136015 } },
+            { { 18.346008679530428, -12.541237184864809 }, { 18.332012141987114, 3.9030436489671665 } },
+            { { 18.517294533104685, -0.085617225853532819 }, { 18.513435319968814, 10.281660088648106 } },
+            { { 17.741265147285056, -1.1428680260419635 }, { 17.735366635499521, 8.1067183458088028 } },
+            { { 18.255337132413107, 1.0548740235761542 }, { 18.260309958077897, -11.847605997592222 } },
+            { { 18.566586705896778, 2.9038510357001353 }, { 18.562835327663645, -6.7266737084653654 } },
+            { { 17.945528844401071, -6.5010486563858816 }, { 17.951247914641574, -10.659097798379097 } },
+            { { 17.496552866913614, -3.8176728867234071 }, { 17.494492593696325, -16.182855679407012 } },
+            { { 17.807577056122796, 20.14810900777432 }, { 17.812975953785294, 13.789109722711185 } },
+            { { 17.31061890351117, 5.1353654224818159 }, { 17.265824646047403, -11.350186027199371 } },
+            { { 15.930115867018305, -9.5586197490121734 }, { 15.921656474204553, 2.1547035521480864 } },
+            { { 14.72448833639932, 1.4912772441780107 }, { 14.73596806086892, -1.2842263607048041 } },
+            { { 13.236513873420767, 1.7156401333610796 }, { 12.940295874000348, 3.0487294435605894 } },
+        },
+    },
+};
+
+#endif // __EFFECT_REGRESSION_GOLDEN_H__
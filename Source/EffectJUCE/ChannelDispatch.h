@@ -0,0 +1,26 @@
+#pragma once
+#include <type_traits>
+
+// Compile-time channel counts for per-channel loops.
+// Mono and stereo get their own instantiations with fixed trip counts; 0 stands for a count known only at run time.
+template <int FixedChannels>
+using ChannelCount = std::integral_constant<int, FixedChannels>;
+
+// Calls function with ChannelCount<1>, ChannelCount<2>, or ChannelCount<0> for any other count
+template <typename Function>
+void dispatchChannelCount(int numChannels, Function&& function)
+{
+    switch (numChannels)
+    {
+        case 1:  function(ChannelCount<1> {}); break;
+        case 2:  function(ChannelCount<2> {}); break;
+        default: function(ChannelCount<0> {}); break;
+    }
+}
+
+// Loop bound inside a specialised body: the constant when fixed, otherwise the run-time count
+template <int FixedChannels>
+constexpr int channelsFor(int numChannels)
+{
+    return FixedChannels > 0 ? FixedChannels : numChannels;
+}
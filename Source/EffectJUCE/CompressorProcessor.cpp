@@ -0,0 +1,133 @@
+#include "CompressorProcessor.h"
+
+namespace
+{
+    constexpr float ln10 = 2.302585093f;
+}
+
+void CompressorProcessor::prepare(double sampleRate, int maximumBlockSize, float maximumLookaheadMs)
+{
+    juce::ignoreUnused(maximumBlockSize); // Processing runs in fixed sub-blocks
+
+    currentSampleRate = sampleRate;
+    maxLookaheadSamples = juce::roundToInt(maximumLookaheadMs * 0.001 * sampleRate);
+
+    // Power-of-two ring so the wrap is a mask
+    lookaheadBuffer.setSize(2, juce::nextPowerOfTwo(maxLookaheadSamples + 1));
+    bufferMask = lookaheadBuffer.getNumSamples() - 1;
+
+    // Force a coefficient update for the new rate
+    attackMs = releaseMs = -1.0f;
+    reset();
+}
+
+void CompressorProcessor::reset()
+{
+    lookaheadBuffer.clear();
+    writePosition = 0;
+    envelopeDb = 0.0f;
+    updateCoefficients();
+}
+
+int CompressorProcessor::getLatencySamples(float lookaheadMs) const
+{
+    return juce::jlimit(0, maxLookaheadSamples, juce::roundToInt(lookaheadMs * 0.001 * currentSampleRate));
+}
+
+void CompressorProcessor::updateCoefficients()
+{
+    thresholdDb = targetThresholdDb.load();
+    slope = 1.0f - 1.0f / juce::jmax(1.0f, targetRatio.load());
+    lookaheadSamples = getLatencySamples(targetLookaheadMs.load());
+
+    const float newAttackMs = juce::jmax(0.01f, targetAttackMs.load());
+    const float newReleaseMs = juce::jmax(0.01f, targetReleaseMs.load());
+
+    // Same time constants as juce::dsp::BallisticsFilter, so settings carry over from juce::dsp::Compressor
+    if (newAttackMs != attackMs || newReleaseMs != releaseMs)
+    {
+        attackMs = newAttackMs;
+        releaseMs = newReleaseMs;
+        const double radiansPerMs = juce::MathConstants<double>::twoPi * 1000.0 / currentSampleRate;
+        attackCoefficient = static_cast<float>(std::exp(-radiansPerMs / attackMs));
+        releaseCoefficient = static_cast<float>(std::exp(-radiansPerMs / releaseMs));
+    }
+}
+
+void CompressorProcessor::process(juce::AudioBuffer<float>& buffer, int numSamples,
+                                  const juce::dsp::AudioBlock<const float>& sidechain)
+{
+    if (lookaheadBuffer.getNumSamples() == 0 || buffer.getNumChannels() < 2)
+        return;
+
+    // Pick up parameter changes once per block
+    updateCoefficients();
+
+    float* channels[2] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
+    const float* detectorChannels[2] = { channels[0], channels[1] };
+
+    if (sidechain.getNumChannels() > 0 && static_cast<int>(sidechain.getNumSamples()) >= numSamples)
+    {
+        detectorChannels[0] = sidechain.getChannelPointer(0);
+        detectorChannels[1] = sidechain.getChannelPointer(juce::jmin<size_t>(1, sidechain.getNumChannels() - 1));
+    }
+
+    for (int start = 0; start < numSamples; start += subBlockSize)
+    {
+        const int count = juce::jmin(subBlockSize, numSamples - start);
+        float* subChannels[2] = { channels[0] + start, channels[1] + start };
+        const float* subDetector[2] = { detectorChannels[0] + start, detectorChannels[1] + start };
+        processSubBlock(subChannels, subDetector, count);
+    }
+}
+
+void CompressorProcessor::processSubBlock(float* const* channels, const float* const* detectorChannels, int numSamples)
+{
+    // Stereo-linked peak level: max(|L|, |R|), read before the channels are overwritten
+    juce::FloatVectorOperations::abs(detector, detectorChannels[0], numSamples);
+    juce::FloatVectorOperations::abs(scratch, detectorChannels[1], numSamples);
+    juce::FloatVectorOperations::max(detector, detector, scratch, numSamples);
+    juce::FloatVectorOperations::max(detector, detector, minimumLevel, numSamples);
+
+    // Level in dB for the whole sub-block, then the static curve: (level - threshold) * (1 - 1/ratio) above threshold
+    for (int i = 0; i < numSamples; ++i)
+        detector[i] = std::log10(detector[i]);
+    juce::FloatVectorOperations::multiply(detector, 20.0f, numSamples);
+    juce::FloatVectorOperations::add(detector, -thresholdDb, numSamples);
+    juce::FloatVectorOperations::max(detector, detector, 0.0f, numSamples);
+    juce::FloatVectorOperations::multiply(detector, slope, numSamples);
+
+    // Attack/release on the gain reduction in dB; the only serial step
+    float envelope = envelopeDb;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float coefficient = detector[i] > envelope ? attackCoefficient : releaseCoefficient;
+        envelope = detector[i] + coefficient * (envelope - detector[i]);
+        gains[i] = envelope;
+    }
+    envelopeDb = envelope;
+
+    // dB to linear gain in one pass: 10^(-gr / 20) = exp(-gr * ln(10) / 20)
+    juce::FloatVectorOperations::multiply(gains, -0.05f * ln10, numSamples);
+    for (int i = 0; i < numSamples; ++i)
+        gains[i] = std::exp(gains[i]);
+
+    // Delay the audio by the lookahead so the gain lands ahead of the transient that caused it
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        float* io = channels[channel];
+        float* memory = lookaheadBuffer.getWritePointer(channel);
+        int position = writePosition;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            memory[position] = io[i];
+            scratch[i] = memory[(position - lookaheadSamples) & bufferMask];
+            position = (position + 1) & bufferMask;
+        }
+
+        juce::FloatVectorOperations::multiply(io, scratch, gains, numSamples);
+    }
+
+    writePosition = (writePosition + numSamples) & bufferMask;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+
+// Stereo-linked feed-forward compressor with lookahead and an optional external sidechain.
+// Detection and the gain computer run on whole sub-blocks; only the attack/release filter is per sample.
+class CompressorProcessor
+{
+public:
+    CompressorProcessor() = default;
+    ~CompressorProcessor() = default;
+
+    // Allocate the lookahead delay; the only place that allocates
+    void prepare(double sampleRate, int maximumBlockSize, float maximumLookaheadMs = 20.0f);
+    void reset();
+
+    // Process stereo audio in place (channels 0 and 1). The detector reads the sidechain when
+    // it is non-empty (same length as the block), otherwise the input itself.
+    void process(juce::AudioBuffer<float>& buffer, int numSamples,
+                 const juce::dsp::AudioBlock<const float>& sidechain = {});
+
+    // Update parameters (safe to call from the message thread)
+    void setThreshold(float newThresholdDb) { targetThresholdDb.store(newThresholdDb); }
+    void setRatio(float ratio) { targetRatio.store(ratio); }
+    void setAttack(float newAttackMs) { targetAttackMs.store(newAttackMs); }
+    void setRelease(float newReleaseMs) { targetReleaseMs.store(newReleaseMs); }
+    void setLookahead(float lookaheadMs) { targetLookaheadMs.store(lookaheadMs); }
+
+    // Latency of the given lookahead, in samples
+    int getLatencySamples(float lookaheadMs) const;
+
+private:
+    static constexpr int subBlockSize = 64;
+    static constexpr float minimumLevel = 1.0e-6f; // -120 dB floor before the log
+
+    void updateCoefficients();
+    void processSubBlock(float* const* channels, const float* const* detectorChannels, int numSamples);
+
+    juce::AudioBuffer<float> lookaheadBuffer;
+    int bufferMask = 0;
+    int writePosition = 0;
+    int lookaheadSamples = 0;
+    int maxLookaheadSamples = 0;
+    double currentSampleRate = 44100.0;
+
+    std::atomic<float> targetThresholdDb { -10.0f };
+    std::atomic<float> targetRatio { 4.0f };
+    std::atomic<float> targetAttackMs { 2.0f };
+    std::atomic<float> targetReleaseMs { 100.0f };
+    std::atomic<float> targetLookaheadMs { 0.0f };
+
+    // Applied values; coefficients are only recomputed when these change
+    float thresholdDb = 0.0f;
+    float slope = 0.0f; // 1 - 1 / ratio
+    float attackMs = -1.0f;
+    float releaseMs = -1.0f;
+    float attackCoefficient = 0.0f;
+    float releaseCoefficient = 0.0f;
+
+    // Smoothed gain reduction in dB, shared by both channels
+    float envelopeDb = 0.0f;
+
+    // Per sub-block scratch
+    float detector[subBlockSize] = {};
+    float scratch[subBlockSize] = {};
+    float gains[subBlockSize] = {};
+};
@@ -0,0 +1,89 @@
+#include "ConvolutionReverbProcessor.h"
+
+ConvolutionReverbProcessor::ConvolutionReverbProcessor()
+{
+    const double defaultSampleRate = 48000.0;
+    loadImpulseResponse(makeDefaultImpulseResponse(defaultSampleRate), defaultSampleRate);
+}
+
+juce::AudioBuffer<float> ConvolutionReverbProcessor::makeDefaultImpulseResponse(double sampleRate)
+{
+    const int length = static_cast<int>(defaultDecaySeconds * sampleRate);
+    juce::AudioBuffer<float> impulseResponse(2, length);
+    juce::Random random(0x5eed);
+
+    // -60 dB at defaultDecaySeconds, independent noise per channel for a wide tail
+    const float decayPerSample = std::pow(0.001f, 1.0f / static_cast<float>(length));
+
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        auto* data = impulseResponse.getWritePointer(channel);
+        float envelope = 1.0f;
+
+        for (int i = 0; i < length; ++i)
+        {
+            data[i] = (random.nextFloat() * 2.0f - 1.0f) * envelope;
+            envelope *= decayPerSample;
+        }
+    }
+
+    return impulseResponse;
+}
+
+void ConvolutionReverbProcessor::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    convolution.prepare(spec);
+    wetGain.prepare(spec);
+    wetGain.setRampDurationSeconds(0.02);
+    mixer.prepare(spec);
+    reset();
+}
+
+void ConvolutionReverbProcessor::reset()
+{
+    // Targets first, so the resets start the smoothers at the current values
+    convolution.reset();
+    wetGain.setGainDecibels(targetWetGainDb.load());
+    wetGain.reset();
+    mixer.setWetMixProportion(targetMix.load());
+    mixer.reset();
+}
+
+void ConvolutionReverbProcessor::process(juce::AudioBuffer<float>& buffer, int numSamples)
+{
+    if (buffer.getNumChannels() < 2)
+        return;
+
+    // Pick up parameter changes once per block; gain and mixer smooth the change
+    wetGain.setGainDecibels(targetWetGainDb.load());
+    mixer.setWetMixProportion(targetMix.load());
+
+    juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers(), 2, static_cast<size_t>(numSamples));
+    mixer.pushDrySamples(block);
+
+    juce::dsp::ProcessContextReplacing<float> context(block);
+    convolution.process(context);
+    wetGain.process(context);
+
+    mixer.mixWetSamples(block);
+}
+
+bool ConvolutionReverbProcessor::loadImpulseResponse(const juce::File& file)
+{
+    if (!file.existsAsFile())
+        return false;
+
+    // Only queues the request; reading happens on the background loader
+    convolution.loadImpulseResponse(file, juce::dsp::Convolution::Stereo::yes,
+                                    juce::dsp::Convolution::Trim::yes, 0,
+                                    juce::dsp::Convolution::Normalise::yes);
+    return true;
+}
+
+void ConvolutionReverbProcessor::loadImpulseResponse(juce::AudioBuffer<float>&& impulseResponse, double impulseSampleRate)
+{
+    convolution.loadImpulseResponse(std::move(impulseResponse), impulseSampleRate,
+                                    juce::dsp::Convolution::Stereo::yes,
+                                    juce::dsp::Convolution::Trim::no,
+                                    juce::dsp::Convolution::Normalise::yes);
+}
@@ -0,0 +1,266 @@
+#include "DistortionProcessor.h"
+
+namespace
+{
+    // Bias of the tube curve; the operating point sits off centre, so it clips harder on one side
+    constexpr float tubeBias = 0.25f;
+}
+
+DistortionProcessor::DistortionProcessor()
+{
+    const float step = 2.0f * tableLimit / static_cast<float>(tableSize);
+
+    for (int curve = 0; curve < numCurves; ++curve)
+    {
+        auto& table = tables[static_cast<size_t>(curve)];
+        table.resize(tableSize + 2);
+
+        for (int i = 0; i < tableSize + 2; ++i)
+            table[static_cast<size_t>(i)] = evaluateCurve(static_cast<Curve>(curve), -tableLimit + static_cast<float>(i) * step);
+    }
+
+    // Integer latency keeps the reported delay exact
+    for (int filter = 0; filter < numOversamplingFilters; ++filter)
+        for (int order = 1; order <= maxOversamplingOrder; ++order)
+            oversamplers[filter][order - 1] = std::make_unique<juce::dsp::Oversampling<float>>(
+                2, static_cast<size_t>(order),
+                filter == HalfBandFIR ? juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple
+                                      : juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
+                true, true);
+}
+
+float DistortionProcessor::evaluateCurve(Curve curve, float x)
+{
+    switch (curve)
+    {
+        case SoftClip:
+        {
+            // Cubic soft clip with unity slope at zero, flat at |x| >= 1.5
+            const float clipped = juce::jlimit(-1.0f, 1.0f, x / 1.5f);
+            return 1.5f * (clipped - clipped * clipped * clipped / 3.0f);
+        }
+
+        case Tube:
+        {
+            // Biased tanh, shifted to pass through zero and scaled to unity slope at zero
+            const float offset = std::tanh(tubeBias);
+            return (std::tanh(x + tubeBias) - offset) / (1.0f - offset * offset);
+        }
+
+        case Tanh:
+        default:
+            return std::tanh(x);
+    }
+}
+
+void DistortionProcessor::prepare(double sampleRate, int maximumBlockSize)
+{
+    hostSampleRate = sampleRate;
+
+    for (auto& filterOversamplers : oversamplers)
+        for (auto& oversampler : filterOversamplers)
+            oversampler->initProcessing(static_cast<size_t>(maximumBlockSize));
+
+    reset();
+}
+
+void DistortionProcessor::reset()
+{
+    for (auto& filterOversamplers : oversamplers)
+        for (auto& oversampler : filterOversamplers)
+            oversampler->reset();
+
+    currentOversampling = targetOversampling.load();
+    setProcessingRate(hostSampleRate * static_cast<double>(1 << (currentOversampling & 0xff)));
+
+    currentCurve = previousCurve = static_cast<Curve>(targetCurve.load());
+    curveChanged = false;
+
+    for (int channel = 0; channel < 2; ++channel)
+        dcInput[channel] = dcOutput[channel] = 0.0f;
+}
+
+void DistortionProcessor::setOversampling(int newOrder, OversamplingFilter newFilter)
+{
+    targetOversampling.store(juce::jlimit(0, maxOversamplingOrder, newOrder) | (static_cast<int>(newFilter) << 8));
+}
+
+int DistortionProcessor::getLatencySamples(int order, OversamplingFilter filter) const
+{
+    if (auto* oversampler = getOversampler(order, filter))
+        return juce::roundToInt(oversampler->getLatencyInSamples());
+
+    return 0;
+}
+
+juce::dsp::Oversampling<float>* DistortionProcessor::getOversampler(int order, int filter) const
+{
+    if (order <= 0 || order > maxOversamplingOrder || !juce::isPositiveAndBelow(filter, static_cast<int>(numOversamplingFilters)))
+        return nullptr;
+
+    return oversamplers[filter][order - 1].get();
+}
+
+void DistortionProcessor::setProcessingRate(double newProcessingRate)
+{
+    // Ramps and the DC blocker run at the oversampled rate
+    drive.reset(newProcessingRate, gainSmoothingSeconds);
+    range.reset(newProcessingRate, gainSmoothingSeconds);
+    blend.reset(newProcessingRate, gainSmoothingSeconds);
+    dcCoefficient = 1.0f - juce::MathConstants<float>::twoPi * dcBlockerHz / static_cast<float>(newProcessingRate);
+
+    drive.setCurrentAndTargetValue(targetDrive.load());
+    range.setCurrentAndTargetValue(targetRange.load());
+    blend.setCurrentAndTargetValue(juce::jlimit(0.0f, 1.0f, targetBlend.load()));
+}
+
+void DistortionProcessor::process(juce::AudioBuffer<float>& buffer, int numSamples)
+{
+    if (buffer.getNumChannels() < 2)
+        return;
+
+    // The latency changes with the setting, so the filters restart rather than crossfade
+    const int oversampling = targetOversampling.load();
+    if (oversampling != currentOversampling)
+    {
+        currentOversampling = oversampling;
+        if (auto* oversampler = getOversampler(oversampling & 0xff, oversampling >> 8))
+            oversampler->reset();
+        setProcessingRate(hostSampleRate * static_cast<double>(1 << (oversampling & 0xff)));
+    }
+
+    // Pick up parameter changes once per block
+    drive.setTargetValue(targetDrive.load());
+    range.setTargetValue(targetRange.load());
+    blend.setTargetValue(juce::jlimit(0.0f, 1.0f, targetBlend.load()));
+
+    const auto curve = static_cast<Curve>(juce::jlimit(0, numCurves - 1, targetCurve.load()));
+    if (curve != currentCurve)
+    {
+        previousCurve = currentCurve;
+        currentCurve = curve;
+        curveChanged = true;
+
+        // The DC blocker only follows the tube curve, so it starts from rest each time the tube comes in
+        if (currentCurve == Tube)
+            for (int channel = 0; channel < 2; ++channel)
+                dcInput[channel] = dcOutput[channel] = 0.0f;
+    }
+
+    // Dry and shaped paths both run at the oversampled rate, so they stay aligned
+    juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers(), 2, static_cast<size_t>(numSamples));
+    auto* oversampler = getOversampler(currentOversampling & 0xff, currentOversampling >> 8);
+    auto shapingBlock = oversampler != nullptr ? oversampler->processSamplesUp(block) : block;
+
+    float* channels[2] = { shapingBlock.getChannelPointer(0), shapingBlock.getChannelPointer(1) };
+    const int shapingSamples = static_cast<int>(shapingBlock.getNumSamples());
+
+    for (int start = 0; start < shapingSamples; start += subBlockSize)
+    {
+        const int count = juce::jmin(subBlockSize, shapingSamples - start);
+        float* subChannels[2] = { channels[0] + start, channels[1] + start };
+        processSubBlock(subChannels, count);
+    }
+
+    if (oversampler != nullptr)
+        oversampler->processSamplesDown(block);
+}
+
+void DistortionProcessor::blockDC(int channel, float* samples, int numSamples)
+{
+    float x1 = dcInput[channel];
+    float y1 = dcOutput[channel];
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float x = samples[i];
+        y1 = x - x1 + dcCoefficient * y1;
+        x1 = x;
+        samples[i] = y1;
+    }
+    dcInput[channel] = x1;
+    dcOutput[channel] = y1;
+}
+
+void DistortionProcessor::shapeBlock(Curve curve, const float* input, float* output, int numSamples)
+{
+    // Table position in one vector pass, then a gather-and-interpolate loop
+    const float scale = static_cast<float>(tableSize) / (2.0f * tableLimit);
+    juce::FloatVectorOperations::clip(output, input, -tableLimit, tableLimit, numSamples);
+    juce::FloatVectorOperations::add(output, tableLimit, numSamples);
+    juce::FloatVectorOperations::multiply(output, scale, numSamples);
+
+    const float* table = tables[static_cast<size_t>(curve)].data();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const int index = static_cast<int>(output[i]);
+        const float fraction = output[i] - static_cast<float>(index);
+        output[i] = table[index] + fraction * (table[index + 1] - table[index]);
+    }
+}
+
+void DistortionProcessor::processSubBlock(float* const* channels, int numSamples)
+{
+    // Ramps only while a parameter moves; otherwise scalar gains
+    const bool smoothing = drive.isSmoothing() || range.isSmoothing() || blend.isSmoothing();
+    float driveGain = 0.0f, outputGain = 0.0f, blendGain = 0.0f;
+
+    if (smoothing)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            driveGains[i] = drive.getNextValue();
+            blendGains[i] = blend.getNextValue();
+            rangeGains[i] = range.getNextValue() * blendGains[i];
+        }
+    }
+    else
+    {
+        driveGain = drive.getNextValue();
+        blendGain = blend.getNextValue();
+        outputGain = range.getNextValue() * blendGain;
+    }
+
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        float* io = channels[channel];
+
+        if (smoothing)
+            juce::FloatVectorOperations::multiply(driven, io, driveGains, numSamples);
+        else
+            juce::FloatVectorOperations::multiply(driven, io, driveGain, numSamples);
+
+        shapeBlock(currentCurve, driven, shaped, numSamples);
+        if (currentCurve == Tube)
+            blockDC(channel, shaped, numSamples);
+
+        // Linear crossfade from the previous curve after a change
+        if (curveChanged)
+        {
+            shapeBlock(previousCurve, driven, fadeShaped, numSamples);
+            if (previousCurve == Tube)
+                blockDC(channel, fadeShaped, numSamples);
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const float fade = static_cast<float>(i + 1) / static_cast<float>(numSamples);
+                shaped[i] = fadeShaped[i] + fade * (shaped[i] - fadeShaped[i]);
+            }
+        }
+
+        // shaped * range * blend + dry * (1 - blend)
+        if (smoothing)
+        {
+            juce::FloatVectorOperations::multiply(shaped, rangeGains, numSamples);
+            juce::FloatVectorOperations::multiply(driven, io, blendGains, numSamples);
+            juce::FloatVectorOperations::subtract(io, driven, numSamples);
+        }
+        else
+        {
+            juce::FloatVectorOperations::multiply(shaped, outputGain, numSamples);
+            juce::FloatVectorOperations::multiply(io, 1.0f - blendGain, numSamples);
+        }
+        juce::FloatVectorOperations::add(io, shaped, numSamples);
+    }
+
+    curveChanged = false;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+// Stereo waveshaper with selectable transfer curves.
+// Curves are precomputed into interpolated tables; drive, range and blend are smoothed per sub-block.
+// The shaping can run oversampled (2x/4x/8x) to keep the generated harmonics from aliasing.
+class DistortionProcessor
+{
+public:
+    enum Curve
+    {
+        Tanh = 0,
+        SoftClip,
+        Tube,
+        numCurves
+    };
+
+    enum OversamplingFilter
+    {
+        PolyphaseIIR = 0, // Low latency, non-linear phase
+        HalfBandFIR,      // Linear phase, longer latency
+        numOversamplingFilters
+    };
+
+    static constexpr int maxOversamplingOrder = 3; // 2^3 = 8x
+
+    DistortionProcessor();
+    ~DistortionProcessor() = default;
+
+    void prepare(double sampleRate, int maximumBlockSize);
+    void reset();
+
+    // Process stereo audio in place (channels 0 and 1)
+    void process(juce::AudioBuffer<float>& buffer, int numSamples);
+
+    // Update parameters (safe to call from the message thread)
+    void setDrive(float newDrive) { targetDrive.store(newDrive); }  // Input gain, 1 = unity
+    void setRange(float newRange) { targetRange.store(newRange); }  // Output gain of the shaped signal
+    void setBlend(float newBlend) { targetBlend.store(newBlend); }  // 0 = dry, 1 = shaped
+    void setCurve(Curve newCurve) { targetCurve.store(newCurve); }
+    void setOversampling(int newOrder, OversamplingFilter newFilter);  // Order 0 = off
+
+    // Latency of the given oversampling setting, in samples at the host rate
+    int getLatencySamples(int order, OversamplingFilter filter) const;
+
+private:
+    static constexpr int subBlockSize = 64;
+    static constexpr int tableSize = 4096;
+    static constexpr float tableLimit = 16.0f; // Every curve is flat beyond this input
+    static constexpr float gainSmoothingSeconds = 0.02f;
+    static constexpr float dcBlockerHz = 10.0f;
+
+    static float evaluateCurve(Curve curve, float x);
+    void processSubBlock(float* const* channels, int numSamples);
+    void shapeBlock(Curve curve, const float* input, float* output, int numSamples);
+    void blockDC(int channel, float* samples, int numSamples);  // In place, tube curve only
+    void setProcessingRate(double newProcessingRate);
+    juce::dsp::Oversampling<float>* getOversampler(int order, int filter) const;
+
+    // tableSize + 2 points per curve over [-tableLimit, tableLimit], the last one a guard for interpolation
+    std::array<std::vector<float>, numCurves> tables;
+
+    std::atomic<float> targetDrive { 6.0f };
+    std::atomic<float> targetRange { 0.5f };
+    std::atomic<float> targetBlend { 0.5f };
+    std::atomic<int> targetCurve { Tanh };
+    std::atomic<int> targetOversampling { 0 }; // order | filter << 8, so both switch together
+
+    // One oversampler per order and filter type, built up front so switching never allocates
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplers[numOversamplingFilters][maxOversamplingOrder];
+    int currentOversampling = -1;
+    double hostSampleRate = 44100.0;
+
+    juce::SmoothedValue<float> drive;
+    juce::SmoothedValue<float> range;
+    juce::SmoothedValue<float> blend;
+    Curve currentCurve = Tanh;
+    Curve previousCurve = Tanh; // Crossfaded out over the first sub-block after a change
+    bool curveChanged = false;
+
+    // The asymmetric tube curve adds DC, removed from its shaped output only; the other curves are symmetric
+    float dcCoefficient = 0.999f;
+    float dcInput[2] = {};
+    float dcOutput[2] = {};
+
+    // Per sub-block scratch
+    float driveGains[subBlockSize] = {};
+    float rangeGains[subBlockSize] = {};
+    float blendGains[subBlockSize] = {};
+    float driven[subBlockSize] = {};
+    float shaped[subBlockSize] = {};
+    float fadeShaped[subBlockSize] = {};
+};
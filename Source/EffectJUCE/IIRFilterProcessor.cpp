@@ -1,62 +1,512 @@
 #include "IIRFilterProcessor.h"
+#include <algorithm>
 #include <cmath>
+#include <complex>
+#include <utility>
+
+namespace
+{
+    // Two channels of one biquad stage side by side; lane 0 is left, lane 1 right
+#if JUCE_USE_SSE_INTRINSICS
+    struct StereoLanes
+    {
+        __m128 v;
+
+        static StereoLanes make(float left, float right) { return { _mm_setr_ps(left, right, 0.0f, 0.0f) }; }
+        static StereoLanes load(const float* left, const float* right) { return { _mm_unpacklo_ps(_mm_load_ss(left), _mm_load_ss(right)) }; }
+        void store(float* left, float* right) const { _mm_store_ss(left, v); _mm_store_ss(right, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+        float lane(int index) const { alignas(16) float lanes[4]; _mm_store_ps(lanes, v); return lanes[index]; }
+
+        friend StereoLanes operator+(StereoLanes a, StereoLanes b) { return { _mm_add_ps(a.v, b.v) }; }
+        friend StereoLanes operator-(StereoLanes a, StereoLanes b) { return { _mm_sub_ps(a.v, b.v) }; }
+        friend StereoLanes operator*(StereoLanes a, StereoLanes b) { return { _mm_mul_ps(a.v, b.v) }; }
+    };
+#elif JUCE_USE_ARM_NEON
+    struct StereoLanes
+    {
+        float32x2_t v;
+
+        static StereoLanes make(float left, float right) { return { vset_lane_f32(right, vdup_n_f32(left), 1) }; }
+        static StereoLanes load(const float* left, const float* right) { return make(*left, *right); }
+        void store(float* left, float* right) const { *left = vget_lane_f32(v, 0); *right = vget_lane_f32(v, 1); }
+        float lane(int index) const { return index == 0 ? vget_lane_f32(v, 0) : vget_lane_f32(v, 1); }
+
+        friend StereoLanes operator+(StereoLanes a, StereoLanes b) { return { vadd_f32(a.v, b.v) }; }
+        friend StereoLanes operator-(StereoLanes a, StereoLanes b) { return { vsub_f32(a.v, b.v) }; }
+        friend StereoLanes operator*(StereoLanes a, StereoLanes b) { return { vmul_f32(a.v, b.v) }; }
+    };
+#else
+    struct StereoLanes
+    {
+        float l, r;
+
+        static StereoLanes make(float left, float right) { return { left, right }; }
+        static StereoLanes load(const float* left, const float* right) { return { *left, *right }; }
+        void store(float* left, float* right) const { *left = l; *right = r; }
+        float lane(int index) const { return index == 0 ? l : r; }
+
+        friend StereoLanes operator+(StereoLanes a, StereoLanes b) { return { a.l + b.l, a.r + b.r }; }
+        friend StereoLanes operator-(StereoLanes a, StereoLanes b) { return { a.l - b.l, a.r - b.r }; }
+        friend StereoLanes operator*(StereoLanes a, StereoLanes b) { return { a.l * b.l, a.r * b.r }; }
+    };
+#endif
+
+    // One stage of a ramping block with its coefficients, per-sample coefficient steps and state, in float or StereoLanes
+    template <typename Value>
+    struct CascadeStage
+    {
+        Value b0, b1, b2, a1, a2;
+        Value db0, db1, db2, da1, da2;
+        Value s1, s2;
+    };
+
+    // Runs the cascade sample by sample, adding the coefficient steps before each sample
+    template <typename Value, typename Load, typename Store>
+    void runRampedCascade(CascadeStage<Value>* stages, int numStages, int numSamples, Load&& load, Store&& store)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            Value x = load(i);
+
+            for (int s = 0; s < numStages; ++s)
+            {
+                auto& stage = stages[s];
+                stage.b0 = stage.b0 + stage.db0;
+                stage.b1 = stage.b1 + stage.db1;
+                stage.b2 = stage.b2 + stage.db2;
+                stage.a1 = stage.a1 + stage.da1;
+                stage.a2 = stage.a2 + stage.da2;
+
+                const Value y = stage.b0 * x + stage.s1;
+                stage.s1 = stage.b1 * x - stage.a1 * y + stage.s2;
+                stage.s2 = stage.b2 * x - stage.a2 * y;
+                x = y;
+            }
+
+            store(i, x);
+        }
+    }
+
+    // Four consecutive cascade stages side by side; lane 0 is the earliest stage
+#if JUCE_USE_SSE_INTRINSICS
+    struct QuadLanes
+    {
+        __m128 v;
+
+        static QuadLanes load(const float* p) { return { _mm_load_ps(p) }; }
+        static QuadLanes broadcast(float value) { return { _mm_set1_ps(value) }; }
+        void store(float* p) const { _mm_store_ps(p, v); }
+        float lastLane() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+        // Each stage's input: the previous step's output of the stage before it
+        static QuadLanes shiftIn(QuadLanes current, QuadLanes previousGroup)
+        {
+            const __m128 shifted = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(current.v), 4));
+            return { _mm_move_ss(shifted, _mm_shuffle_ps(previousGroup.v, previousGroup.v, _MM_SHUFFLE(3, 3, 3, 3))) };
+        }
+        static QuadLanes shiftIn(QuadLanes current, float input)
+        {
+            return { _mm_move_ss(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(current.v), 4)), _mm_set_ss(input)) };
+        }
+
+        // a in lanes whose sample index lies in [0, lastSample], b elsewhere
+        static QuadLanes selectInBlock(QuadLanes sampleIndex, float lastSample, QuadLanes a, QuadLanes b)
+        {
+            const __m128 mask = _mm_and_ps(_mm_cmpge_ps(sampleIndex.v, _mm_setzero_ps()), _mm_cmple_ps(sampleIndex.v, _mm_set1_ps(lastSample)));
+            return { _mm_or_ps(_mm_and_ps(mask, a.v), _mm_andnot_ps(mask, b.v)) };
+        }
+
+        friend QuadLanes operator+(QuadLanes a, QuadLanes b) { return { _mm_add_ps(a.v, b.v) }; }
+        friend QuadLanes operator-(QuadLanes a, QuadLanes b) { return { _mm_sub_ps(a.v, b.v) }; }
+        friend QuadLanes operator*(QuadLanes a, QuadLanes b) { return { _mm_mul_ps(a.v, b.v) }; }
+    };
+#elif JUCE_USE_ARM_NEON
+    struct QuadLanes
+    {
+        float32x4_t v;
+
+        static QuadLanes load(const float* p) { return { vld1q_f32(p) }; }
+        static QuadLanes broadcast(float value) { return { vdupq_n_f32(value) }; }
+        void store(float* p) const { vst1q_f32(p, v); }
+        float lastLane() const { return vgetq_lane_f32(v, 3); }
+
+        static QuadLanes shiftIn(QuadLanes current, QuadLanes previousGroup) { return { vextq_f32(previousGroup.v, current.v, 3) }; }
+        static QuadLanes shiftIn(QuadLanes current, float input) { return { vextq_f32(vdupq_n_f32(input), current.v, 3) }; }
+
+        static QuadLanes selectInBlock(QuadLanes sampleIndex, float lastSample, QuadLanes a, QuadLanes b)
+        {
+            const uint32x4_t mask = vandq_u32(vcgeq_f32(sampleIndex.v, vdupq_n_f32(0.0f)), vcleq_f32(sampleIndex.v, vdupq_n_f32(lastSample)));
+            return { vbslq_f32(mask, a.v, b.v) };
+        }
+
+        friend QuadLanes operator+(QuadLanes a, QuadLanes b) { return { vaddq_f32(a.v, b.v) }; }
+        friend QuadLanes operator-(QuadLanes a, QuadLanes b) { return { vsubq_f32(a.v, b.v) }; }
+        friend QuadLanes operator*(QuadLanes a, QuadLanes b) { return { vmulq_f32(a.v, b.v) }; }
+    };
+#else
+    struct QuadLanes
+    {
+        float v[4];
+
+        static QuadLanes load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+        static QuadLanes broadcast(float value) { return { { value, value, value, value } }; }
+        void store(float* p) const { std::copy(v, v + 4, p); }
+        float lastLane() const { return v[3]; }
+
+        static QuadLanes shiftIn(QuadLanes current, QuadLanes previousGroup) { return { { previousGroup.v[3], current.v[0], current.v[1], current.v[2] } }; }
+        static QuadLanes shiftIn(QuadLanes current, float input) { return { { input, current.v[0], current.v[1], current.v[2] } }; }
+
+        static QuadLanes selectInBlock(QuadLanes sampleIndex, float lastSample, QuadLanes a, QuadLanes b)
+        {
+            QuadLanes result;
+            for (int i = 0; i < 4; ++i)
+                result.v[i] = (sampleIndex.v[i] >= 0.0f && sampleIndex.v[i] <= lastSample) ? a.v[i] : b.v[i];
+            return result;
+        }
+
+        template <typename Op>
+        static QuadLanes apply(QuadLanes a, QuadLanes b, Op op) { return { { op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]) } }; }
+
+        friend QuadLanes operator+(QuadLanes a, QuadLanes b) { return apply(a, b, std::plus<float>()); }
+        friend QuadLanes operator-(QuadLanes a, QuadLanes b) { return apply(a, b, std::minus<float>()); }
+        friend QuadLanes operator*(QuadLanes a, QuadLanes b) { return apply(a, b, std::multiplies<float>()); }
+    };
+#endif
+
+    // One channel's stages as structure-of-arrays, front-padded with unity stages to whole groups of four.
+    // A unity stage with zero state passes its input through exactly.
+    struct SectionArrays
+    {
+        static constexpr int maxGroups = IIRFilterProcessor::maxBands / 4;
+
+        alignas(16) float b0[IIRFilterProcessor::maxBands];
+        alignas(16) float b1[IIRFilterProcessor::maxBands];
+        alignas(16) float b2[IIRFilterProcessor::maxBands];
+        alignas(16) float a1[IIRFilterProcessor::maxBands];
+        alignas(16) float a2[IIRFilterProcessor::maxBands];
+        alignas(16) float s1[IIRFilterProcessor::maxBands];
+        alignas(16) float s2[IIRFilterProcessor::maxBands];
+
+        void load(const IIRFilterProcessor::BiquadFilter* filters, const int* bands, int numStages, int numGroups)
+        {
+            const int padding = numGroups * 4 - numStages;
+            for (int i = 0; i < padding; ++i)
+            {
+                b0[i] = 1.0f;
+                b1[i] = b2[i] = a1[i] = a2[i] = s1[i] = s2[i] = 0.0f;
+            }
+            for (int i = 0; i < numStages; ++i)
+            {
+                const auto& f = filters[bands[i]];
+                b0[padding + i] = f.b0;  b1[padding + i] = f.b1;  b2[padding + i] = f.b2;
+                a1[padding + i] = f.a1;  a2[padding + i] = f.a2;
+                s1[padding + i] = f.s1;  s2[padding + i] = f.s2;
+            }
+        }
+
+        void saveState(IIRFilterProcessor::BiquadFilter* filters, const int* bands, int numStages, int numGroups) const
+        {
+            const int padding = numGroups * 4 - numStages;
+            for (int i = 0; i < numStages; ++i)
+            {
+                filters[bands[i]].s1 = s1[padding + i];
+                filters[bands[i]].s2 = s2[padding + i];
+            }
+        }
+    };
+
+    // Calls f with each index below N as a compile-time constant, highest first, so the calls unroll on any compiler
+    template <int N, typename Function, int... I>
+    void forEachIndexDescending(Function&& f, std::integer_sequence<int, I...>)
+    {
+        (f(std::integral_constant<int, N - 1 - I>()), ...);
+    }
+
+    template <int N, typename Function>
+    void forEachIndexDescending(Function&& f)
+    {
+        forEachIndexDescending<N>(f, std::make_integer_sequence<int, N>());
+    }
+
+    // Runs each channel's cascade as a wavefront: at step t, stage k works on sample t - k, so the four
+    // stages of a group are independent and share one register. Stages are masked outside the block,
+    // which keeps the result identical to running the cascade sample by sample, with no added latency.
+    // MidSide encodes a channel pair as it enters and decodes it as it leaves.
+    template <int NumChannels, int NumGroups, bool MidSide>
+    void runWavefront(SectionArrays* sections, float* const* channels, int numSamples)
+    {
+        static_assert(!MidSide || NumChannels == 2, "mid/side needs a channel pair");
+
+        constexpr int numGroups = NumGroups;
+        QuadLanes b0[NumChannels][NumGroups], b1[NumChannels][NumGroups], b2[NumChannels][NumGroups];
+        QuadLanes a1[NumChannels][NumGroups], a2[NumChannels][NumGroups];
+        QuadLanes s1[NumChannels][NumGroups], s2[NumChannels][NumGroups], y[NumChannels][NumGroups];
+        QuadLanes stageIndex[NumGroups];
+
+        for (int g = 0; g < numGroups; ++g)
+        {
+            alignas(16) const float index[4] = { 4.0f * g, 4.0f * g + 1.0f, 4.0f * g + 2.0f, 4.0f * g + 3.0f };
+            stageIndex[g] = QuadLanes::load(index);
+
+            for (int c = 0; c < NumChannels; ++c)
+            {
+                const auto& arrays = sections[c];
+                b0[c][g] = QuadLanes::load(arrays.b0 + 4 * g);
+                b1[c][g] = QuadLanes::load(arrays.b1 + 4 * g);
+                b2[c][g] = QuadLanes::load(arrays.b2 + 4 * g);
+                a1[c][g] = QuadLanes::load(arrays.a1 + 4 * g);
+                a2[c][g] = QuadLanes::load(arrays.a2 + 4 * g);
+                s1[c][g] = QuadLanes::load(arrays.s1 + 4 * g);
+                s2[c][g] = QuadLanes::load(arrays.s2 + 4 * g);
+                y[c][g] = QuadLanes::load(arrays.s2 + 4 * g); // Any finite value; masked until overwritten
+            }
+        }
+
+        const int numStages = 4 * numGroups;
+        const int numSteps = numSamples + numStages - 1;
+        const float lastSample = static_cast<float>(numSamples - 1);
+
+        // Filling and draining steps mask the stages outside the block; steady steps have every stage in it
+        auto step = [&](int t, auto masked)
+        {
+            constexpr bool isMasked = decltype(masked)::value;
+
+            float input[NumChannels];
+            for (int c = 0; c < NumChannels; ++c)
+                input[c] = (!isMasked || t < numSamples) ? channels[c][t] : 0.0f;
+
+            if constexpr (MidSide)
+            {
+                const float mid = 0.5f * (input[0] + input[1]);
+                input[1] = 0.5f * (input[0] - input[1]);
+                input[0] = mid;
+            }
+
+            forEachIndexDescending<NumChannels>([&](auto channel)
+            {
+                constexpr int c = decltype(channel)::value;
+
+                // Last group first, so each group still sees the previous step's output of the one before
+                forEachIndexDescending<NumGroups>([&](auto group)
+                {
+                    constexpr int g = decltype(group)::value;
+                    QuadLanes x;
+                    if constexpr (g == 0)
+                        x = QuadLanes::shiftIn(y[c][0], input[c]);
+                    else
+                        x = QuadLanes::shiftIn(y[c][g], y[c][g - 1]);
+                    const QuadLanes out = b0[c][g] * x + s1[c][g];
+                    const QuadLanes newS1 = b1[c][g] * x - a1[c][g] * out + s2[c][g];
+                    const QuadLanes newS2 = b2[c][g] * x - a2[c][g] * out;
+
+                    if constexpr (isMasked)
+                    {
+                        const QuadLanes sampleIndex = QuadLanes::broadcast(static_cast<float>(t)) - stageIndex[g];
+                        s1[c][g] = QuadLanes::selectInBlock(sampleIndex, lastSample, newS1, s1[c][g]);
+                        s2[c][g] = QuadLanes::selectInBlock(sampleIndex, lastSample, newS2, s2[c][g]);
+                    }
+                    else
+                    {
+                        s1[c][g] = newS1;
+                        s2[c][g] = newS2;
+                    }
+                    y[c][g] = out;
+                });
+            });
+
+            if (isMasked && t < numStages - 1)
+                return;
+
+            const int i = t - numStages + 1;
+            if constexpr (MidSide)
+            {
+                const float mid = y[0][numGroups - 1].lastLane();
+                const float side = y[1][numGroups - 1].lastLane();
+                channels[0][i] = mid + side;
+                channels[1][i] = mid - side;
+            }
+            else
+            {
+                for (int c = 0; c < NumChannels; ++c)
+                    channels[c][i] = y[c][numGroups - 1].lastLane();
+            }
+        };
+
+        // Pipeline filling, steady state, draining
+        const int steadyStart = juce::jmin(numStages - 1, numSteps);
+        const int steadyEnd = juce::jmax(steadyStart, numSamples);
+        for (int t = 0; t < steadyStart; ++t)
+            step(t, std::true_type());
+        for (int t = steadyStart; t < steadyEnd; ++t)
+            step(t, std::false_type());
+        for (int t = steadyEnd; t < numSteps; ++t)
+            step(t, std::true_type());
+
+        for (int c = 0; c < NumChannels; ++c)
+        {
+            for (int g = 0; g < numGroups; ++g)
+            {
+                s1[c][g].store(sections[c].s1 + 4 * g);
+                s2[c][g].store(sections[c].s2 + 4 * g);
+            }
+        }
+    }
+
+    // Group count as a template argument, so the stages of a step unroll and stay in registers
+    template <int NumChannels, bool MidSide = false>
+    void runWavefront(SectionArrays* sections, float* const* channels, int numGroups, int numSamples)
+    {
+        switch (numGroups)
+        {
+            case 1: runWavefront<NumChannels, 1, MidSide>(sections, channels, numSamples); break;
+            case 2: runWavefront<NumChannels, 2, MidSide>(sections, channels, numSamples); break;
+            case 3: runWavefront<NumChannels, 3, MidSide>(sections, channels, numSamples); break;
+            case 4: runWavefront<NumChannels, 4, MidSide>(sections, channels, numSamples); break;
+            case 5: runWavefront<NumChannels, 5, MidSide>(sections, channels, numSamples); break;
+            case 6: runWavefront<NumChannels, 6, MidSide>(sections, channels, numSamples); break;
+            case 7: runWavefront<NumChannels, 7, MidSide>(sections, channels, numSamples); break;
+            case 8: runWavefront<NumChannels, 8, MidSide>(sections, channels, numSamples); break;
+            default: jassertfalse; break;
+        }
+        static_assert(SectionArrays::maxGroups == 8, "one case per group count");
+    }
+
+    bool isUnity(const IIRFilterProcessor::BiquadCoefficients& c)
+    {
+        return c.b0 == 1.0f && c.b1 == 0.0f && c.b2 == 0.0f && c.a1 == 0.0f && c.a2 == 0.0f;
+    }
+
+    bool isSame(const IIRFilterProcessor::BiquadCoefficients& a, const IIRFilterProcessor::BiquadCoefficients& b)
+    {
+        return a.b0 == b.b0 && a.b1 == b.b1 && a.b2 == b.b2 && a.a1 == b.a1 && a.a2 == b.a2;
+    }
+
+    // Separate mid/side passes, for when the encoded block has to exist in memory
+    void encodeMidSide(float* left, float* right, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float mid = 0.5f * (left[i] + right[i]);
+            right[i] = 0.5f * (left[i] - right[i]);
+            left[i] = mid;
+        }
+    }
+
+    void decodeMidSide(float* mid, float* side, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float left = mid[i] + side[i];
+            side[i] = mid[i] - side[i];
+            mid[i] = left;
+        }
+    }
+}
 
 IIRFilterProcessor::IIRFilterProcessor() : currentSampleRate(44100.0f)
 {
     initializeDefaultParams();
+
+    // No audio thread yet, so take the first set straight away
+    if (auto* set = acquireCoefficients())
+        applyCoefficients(*set);
+
     reset();
 }
 
+IIRFilterProcessor::~IIRFilterProcessor()
+{
+    firDesignPool.removeAllJobs(true, 2000);
+}
+
+void IIRFilterProcessor::prepare(double sampleRate, int maximumBlockSize)
+{
+    maxBlockSize = maximumBlockSize;
+    firBuffer.setSize(1, maximumBlockSize);
+    convolution.prepare({ sampleRate, static_cast<juce::uint32>(maximumBlockSize), 1 });
+    linearPhaseMix.reset(sampleRate, crossfadeSeconds);
+    linearPhaseMix.setCurrentAndTargetValue(0.0f);
+    firRunning = false;
+    firWarmupSamples = 0;
+    alignmentDelay.assign(static_cast<size_t>(getFirLength(sampleRate) / 2), 0.0f);
+    alignmentIndex = 0;
+    alignmentRunning = false;
+    alignmentFillSamples = 0;
+    alignmentMix.reset(sampleRate, crossfadeSeconds);
+    alignmentMix.setCurrentAndTargetValue(0.0f);
+    undelayedBuffer.assign(static_cast<size_t>(maximumBlockSize), 0.0f);
+
+    // Preparing the convolution drops any FIR still on its way, so the next one is always designed
+    firDesignPool.removeAllJobs(true, 2000);
+    firDesignSampleRate = 0.0;
+
+    // Publishes the new coefficients and, in linear-phase mode, redesigns the FIR for this rate
+    setSampleRate(static_cast<float>(sampleRate));
+}
+
+IIRFilterProcessor::FilterType IIRFilterProcessor::filterTypeFromName(const juce::String& name)
+{
+    if (name == "PEQ") return FilterType::Peak;
+    if (name == "LSH") return FilterType::LowShelf;
+    if (name == "HSH") return FilterType::HighShelf;
+    if (name == "LPF") return FilterType::LowPass;
+    if (name == "HPF") return FilterType::HighPass;
+    return FilterType::Bypass;
+}
+
+juce::String IIRFilterProcessor::getFilterTypeName(FilterType type)
+{
+    switch (type)
+    {
+        case FilterType::Peak:      return "PEQ";
+        case FilterType::LowShelf:  return "LSH";
+        case FilterType::HighShelf: return "HSH";
+        case FilterType::LowPass:   return "LPF";
+        case FilterType::HighPass:  return "HPF";
+        case FilterType::Bypass:    break;
+    }
+    return {};
+}
+
 void IIRFilterProcessor::initializeDefaultParams()
 {
-    // Initialize default 7-band EQ parameters
-    bandParams[0] = {"PEQ", 100.0f, 0.0f, 0.7f};   // Band 1: 100 Hz
-    bandParams[1] = {"PEQ", 200.0f, 0.0f, 0.7f};   // Band 2: 200 Hz
-    bandParams[2] = {"PEQ", 400.0f, 0.0f, 0.7f};   // Band 3: 400 Hz
-    bandParams[3] = {"PEQ", 800.0f, 0.0f, 0.7f};   // Band 4: 800 Hz
-    bandParams[4] = {"PEQ", 1600.0f, 0.0f, 0.7f};  // Band 5: 1600 Hz
-    bandParams[5] = {"PEQ", 3200.0f, 0.0f, 0.7f};  // Band 6: 3200 Hz
-    bandParams[6] = {"PEQ", 6400.0f, 0.0f, 0.7f};  // Band 7: 6400 Hz
+    // Initialize default EQ parameters: flat peaks, the first 7 an octave apart from 100 Hz
+    for (int i = 0; i < maxBands; ++i)
+    {
+        const float freq = i < defaultNumBands ? 100.0f * static_cast<float>(1 << i) : 1000.0f;
+        bandParams[i] = {FilterType::Peak, freq, 0.0f, 0.7f};
+    }
     
     // Design all filters with default parameters
-    for (int i = 0; i < 7; ++i)
+    for (int i = 0; i < maxBands; ++i)
     {
-        designFilter(&filters[i], bandParams[i].type, bandParams[i].freq, 
+        designFilter(&designedCoefficients[i], bandParams[i].type, bandParams[i].freq, 
                     bandParams[i].gain, bandParams[i].Q, currentSampleRate);
     }
+    publishCoefficients();
 }
 
-void IIRFilterProcessor::initBiquadFilter(BiquadFilter* filter, float b0, float b1, float b2, float a1, float a2)
+void IIRFilterProcessor::initBiquadFilter(BiquadCoefficients* filter, float b0, float b1, float b2, float a1, float a2)
 {
+    // Coefficients only; the filter state carries over
     filter->b0 = b0;
     filter->b1 = b1;
     filter->b2 = b2;
     filter->a1 = a1;
     filter->a2 = a2;
-    filter->x1 = 0.0f;
-    filter->x2 = 0.0f;
-    filter->y1 = 0.0f;
-    filter->y2 = 0.0f;
 }
 
-float IIRFilterProcessor::processBiquadFilter(BiquadFilter* filter, float input)
+void IIRFilterProcessor::designFilter(BiquadCoefficients* filter, FilterType type, float freq, float gain, float Q, float sampleRate)
 {
-    float output = filter->b0 * input
-                 + filter->b1 * filter->x1
-                 + filter->b2 * filter->x2
-                 - filter->a1 * filter->y1
-                 - filter->a2 * filter->y2;
-
-    filter->x2 = filter->x1;
-    filter->x1 = input;
-    filter->y2 = filter->y1;
-    filter->y1 = output;
+    const bool isGainType = type == FilterType::Peak || type == FilterType::LowShelf || type == FilterType::HighShelf;
 
-    return output;
-}
+    if (type == FilterType::Bypass || (isGainType && std::abs(gain) <= 0.01f))
+    {
+        // Unity band, dropped from the cascade when the set is published
+        initBiquadFilter(filter, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+        return;
+    }
 
-void IIRFilterProcessor::designFilter(BiquadFilter* filter, const juce::String& type, float freq, float gain, float Q, float sampleRate)
-{
     if (freq <= 20.0f || freq >= sampleRate / 2.0f || Q <= 0.0f)
     {
         // Invalid parameters, set to bypass
@@ -72,26 +522,17 @@ void IIRFilterProcessor::designFilter(BiquadFilter* filter, const juce::String&
 
     float a0, b0, b1, b2, a1, a2;
 
-    if (type == "PEQ")
+    if (type == FilterType::Peak)
     {
-        if (std::abs(gain) <= 0.01f)
-        {
-            // Bypass filter when gain is near zero
-            b0 = 1.0f; b1 = 0.0f; b2 = 0.0f;
-            a0 = 1.0f; a1 = 0.0f; a2 = 0.0f;
-        }
-        else
-        {
-            // Standard Peaking EQ (Bell) formula
-            b0 = 1.0f + alpha * A;
-            b1 = -2.0f * cs;
-            b2 = 1.0f - alpha * A;
-            a0 = 1.0f + alpha / A;
-            a1 = -2.0f * cs;
-            a2 = 1.0f - alpha / A;
-        }
+        // Standard Peaking EQ (Bell) formula
+        b0 = 1.0f + alpha * A;
+        b1 = -2.0f * cs;
+        b2 = 1.0f - alpha * A;
+        a0 = 1.0f + alpha / A;
+        a1 = -2.0f * cs;
+        a2 = 1.0f - alpha / A;
     }
-    else if (type == "LSH") // Low Shelf
+    else if (type == FilterType::LowShelf)
     {
         // Low shelf correctly uses /20
         float A_shelf = std::pow(10.0f, gain / 20.0f);
@@ -103,7 +544,7 @@ void IIRFilterProcessor::designFilter(BiquadFilter* filter, const juce::String&
         a1 = -2.0f * ((A_shelf - 1.0f) + (A_shelf + 1.0f) * cs);
         a2 = (A_shelf + 1.0f) + (A_shelf - 1.0f) * cs - 2.0f * std::sqrt(A_shelf) * alpha;
     }
-    else if (type == "HSH") // High Shelf
+    else if (type == FilterType::HighShelf)
     {
         // High shelf correctly uses /20
         float A_shelf = std::pow(10.0f, gain / 20.0f);
@@ -115,7 +556,7 @@ void IIRFilterProcessor::designFilter(BiquadFilter* filter, const juce::String&
         a1 = 2.0f * ((A_shelf - 1.0f) - (A_shelf + 1.0f) * cs);
         a2 = (A_shelf + 1.0f) - (A_shelf - 1.0f) * cs - 2.0f * std::sqrt(A_shelf) * alpha;
     }
-    else if (type == "LPF") // Low Pass
+    else if (type == FilterType::LowPass)
     {
         a0 = 1.0f + alpha;
         b0 = (1.0f - cs) / 2.0f;
@@ -124,7 +565,7 @@ void IIRFilterProcessor::designFilter(BiquadFilter* filter, const juce::String&
         a1 = -2.0f * cs;
         a2 = 1.0f - alpha;
     }
-    else if (type == "HPF") // High Pass
+    else if (type == FilterType::HighPass)
     {
         a0 = 1.0f + alpha;
         b0 = (1.0f + cs) / 2.0f;
@@ -152,27 +593,494 @@ void IIRFilterProcessor::designFilter(BiquadFilter* filter, const juce::String&
     initBiquadFilter(filter, b0, b1, b2, a1, a2);
 }
 
-float IIRFilterProcessor::processEQ(float input)
+void IIRFilterProcessor::publishCoefficients()
 {
-    float output = input;
-    
-    //DBG("Input: " << input);
-    
-    for (int i = 0; i < 7; ++i)
+    // Compile the set: all band coefficients plus the bands that are not unity
+    auto& set = coefficientSets[writerSet];
+    set.numActiveBands = 0;
+    for (int i = 0; i < maxBands; ++i)
     {
-        float before = output;
-        output = processBiquadFilter(&filters[i], output);
-        //DBG("Band " << i << ": " << before << " -> " << output << " (ratio: " << output/before << ")");
+        set.bands[i] = i < numBands ? designedCoefficients[i] : BiquadCoefficients();
+        if (!isUnity(set.bands[i]))
+            set.activeBands[set.numActiveBands++] = i;
     }
-    
-    //DBG("Final output: " << output << " (ratio: " << output/input << ")");
-    
-    return output;
+
+    // Hand the written set over and take back whichever set was shared
+    writerSet = sharedSet.exchange(writerSet | newSetFlag) & ~newSetFlag;
+
+    if (linearPhaseSelected.load())
+    {
+        // The convolution keeps the last FIR, so switching back to linear phase with the same bands
+        // reuses it instead of swapping in an identical one part way through the fade
+        std::array<BiquadCoefficients, maxBands> snapshot;
+        std::copy(set.bands, set.bands + maxBands, snapshot.begin());
+        const double sampleRate = currentSampleRate;
+        if (sampleRate == firDesignSampleRate
+            && std::equal(snapshot.begin(), snapshot.end(), firDesignCoefficients.begin(), isSame))
+            return;
+
+        firDesignCoefficients = snapshot;
+        firDesignSampleRate = sampleRate;
+
+        // Only the newest design matters, so drop any that have not started
+
+        firDesignPool.removeAllJobs(false, 0);
+        firDesignPool.addJob([this, snapshot, sampleRate] { designLinearPhaseFir(snapshot.data(), sampleRate); });
+    }
+}
+
+const IIRFilterProcessor::CoefficientSet* IIRFilterProcessor::acquireCoefficients()
+{
+    if ((sharedSet.load() & newSetFlag) == 0)
+        return nullptr;
+
+    readerSet = sharedSet.exchange(readerSet) & ~newSetFlag;
+    return &coefficientSets[readerSet];
+}
+
+void IIRFilterProcessor::applyCoefficients(const CoefficientSet& set)
+{
+    bool active[maxBands] = {};
+    for (int i = 0; i < set.numActiveBands; ++i)
+        active[set.activeBands[i]] = true;
+
+    for (int band = 0; band < maxBands; ++band)
+    {
+        static_cast<BiquadCoefficients&>(filters[band]) = set.bands[band];
+
+        // A band leaving the cascade starts from rest if it comes back
+        if (!active[band])
+            filters[band].s1 = filters[band].s2 = 0.0f;
+    }
+
+    std::copy(set.activeBands, set.activeBands + set.numActiveBands, activeBands);
+    numActiveBands = set.numActiveBands;
 }
 
-void IIRFilterProcessor::updateBand(int bandIndex, const juce::String& type, float freq, float gain, float Q)
+const IIRFilterProcessor::CoefficientSet* IIRFilterProcessor::beginBlock()
 {
-    if (bandIndex < 0 || bandIndex >= 7)
+    const auto* set = acquireCoefficients();
+    if (set == nullptr)
+        return nullptr;
+
+    if (!interpolateCoefficients.load())
+    {
+        applyCoefficients(*set);
+        return nullptr;
+    }
+
+    return set;
+}
+
+unsigned int IIRFilterProcessor::getBlockStageMask(const CoefficientSet* target) const
+{
+    // While ramping, bands entering or leaving the cascade run too, from or towards unity
+    unsigned int mask = 0;
+    for (int i = 0; i < numActiveBands; ++i)
+        mask |= 1u << activeBands[i];
+
+    if (target != nullptr)
+        for (int i = 0; i < target->numActiveBands; ++i)
+            mask |= 1u << target->activeBands[i];
+
+    return mask;
+}
+
+void IIRFilterProcessor::processBlock(float* data, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+
+    // The FIR buffer holds one prepared block
+    if (maxBlockSize > 0 && numSamples > maxBlockSize)
+    {
+        for (int offset = 0; offset < numSamples; offset += maxBlockSize)
+            processBlock(data + offset, juce::jmin(maxBlockSize, numSamples - offset));
+        return;
+    }
+
+    const bool linearPhase = runLinearPhase(data, numSamples);
+    const auto* target = beginBlock();
+
+    if (target == nullptr)
+    {
+        if (numActiveBands > 0)
+        {
+            const int numGroups = (numActiveBands + 3) / 4;
+            SectionArrays sections;
+            sections.load(filters, activeBands, numActiveBands, numGroups);
+
+            float* channels[] = { data };
+            runWavefront<1>(&sections, channels, numGroups, numSamples);
+            sections.saveState(filters, activeBands, numActiveBands, numGroups);
+        }
+
+        delayMinimumPhase(data, numSamples);
+        if (linearPhase)
+            mixLinearPhase(data, numSamples);
+        return;
+    }
+
+    const unsigned int stageMask = getBlockStageMask(target);
+    const float step = 1.0f / static_cast<float>(numSamples);
+
+    CascadeStage<float> stages[maxBands];
+    int stageBands[maxBands];
+    int numStages = 0;
+    for (int band = 0; band < maxBands; ++band)
+    {
+        if ((stageMask & (1u << band)) == 0)
+            continue;
+
+        const BiquadFilter& f = filters[band];
+        const BiquadCoefficients& t = target->bands[band];
+
+        auto& stage = stages[numStages];
+        stage.b0 = f.b0;  stage.db0 = (t.b0 - f.b0) * step;
+        stage.b1 = f.b1;  stage.db1 = (t.b1 - f.b1) * step;
+        stage.b2 = f.b2;  stage.db2 = (t.b2 - f.b2) * step;
+        stage.a1 = f.a1;  stage.da1 = (t.a1 - f.a1) * step;
+        stage.a2 = f.a2;  stage.da2 = (t.a2 - f.a2) * step;
+        stage.s1 = f.s1;
+        stage.s2 = f.s2;
+        stageBands[numStages++] = band;
+    }
+
+    if (numStages > 0)
+    {
+        auto load = [data](int i) { return data[i]; };
+        auto store = [data](int i, float value) { data[i] = value; };
+        runRampedCascade(stages, numStages, numSamples, load, store);
+    }
+
+    for (int i = 0; i < numStages; ++i)
+    {
+        filters[stageBands[i]].s1 = stages[i].s1;
+        filters[stageBands[i]].s2 = stages[i].s2;
+    }
+
+    applyCoefficients(*target); // Exact end point of the ramp
+
+    delayMinimumPhase(data, numSamples);
+    if (linearPhase)
+        mixLinearPhase(data, numSamples);
+}
+
+void IIRFilterProcessor::processStereoBlock(IIRFilterProcessor& leftEQ, IIRFilterProcessor& rightEQ,
+                                            float* left, float* right, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+
+    const int chunkSize = juce::jmin(leftEQ.maxBlockSize, rightEQ.maxBlockSize);
+    if (chunkSize > 0 && numSamples > chunkSize)
+    {
+        for (int offset = 0; offset < numSamples; offset += chunkSize)
+            processStereoBlock(leftEQ, rightEQ, left + offset, right + offset, juce::jmin(chunkSize, numSamples - offset));
+        return;
+    }
+
+    // The FIR has to see mid and side, so while it runs the matrix gets passes of its own
+    const bool midSide = leftEQ.midSideSelected.load();
+    const bool fusedMidSide = midSide && !leftEQ.isLinearPhaseRunning() && !rightEQ.isLinearPhaseRunning();
+    if (midSide && !fusedMidSide)
+        encodeMidSide(left, right, numSamples);
+
+    const bool leftLinearPhase = leftEQ.runLinearPhase(left, numSamples);
+    const bool rightLinearPhase = rightEQ.runLinearPhase(right, numSamples);
+
+    const auto* leftTarget = leftEQ.beginBlock();
+    const auto* rightTarget = rightEQ.beginBlock();
+
+    if (leftTarget == nullptr && rightTarget == nullptr)
+    {
+        // The shorter cascade gets extra unity stages in front, so both drain on the same step
+        const int numGroups = (juce::jmax(leftEQ.numActiveBands, rightEQ.numActiveBands) + 3) / 4;
+        if (numGroups > 0)
+        {
+            SectionArrays sections[2];
+            sections[0].load(leftEQ.filters, leftEQ.activeBands, leftEQ.numActiveBands, numGroups);
+            sections[1].load(rightEQ.filters, rightEQ.activeBands, rightEQ.numActiveBands, numGroups);
+
+            float* channels[] = { left, right };
+            if (fusedMidSide)
+                runWavefront<2, true>(sections, channels, numGroups, numSamples);
+            else
+                runWavefront<2>(sections, channels, numGroups, numSamples);
+            sections[0].saveState(leftEQ.filters, leftEQ.activeBands, leftEQ.numActiveBands, numGroups);
+            sections[1].saveState(rightEQ.filters, rightEQ.activeBands, rightEQ.numActiveBands, numGroups);
+        }
+    }
+    else
+    {
+        rampStereoBlock(leftEQ, rightEQ, leftTarget, rightTarget, left, right, numSamples, fusedMidSide);
+    }
+
+    leftEQ.delayMinimumPhase(left, numSamples);
+    rightEQ.delayMinimumPhase(right, numSamples);
+    if (leftLinearPhase)
+        leftEQ.mixLinearPhase(left, numSamples);
+    if (rightLinearPhase)
+        rightEQ.mixLinearPhase(right, numSamples);
+
+    if (midSide && !fusedMidSide)
+        decodeMidSide(left, right, numSamples);
+}
+
+void IIRFilterProcessor::rampStereoBlock(IIRFilterProcessor& leftEQ, IIRFilterProcessor& rightEQ,
+                                         const CoefficientSet* leftTarget, const CoefficientSet* rightTarget,
+                                         float* left, float* right, int numSamples, bool midSide)
+{
+    // The two channels, left and right or mid and side, share one register per band.
+    // A band running in only one channel passes the other through, since its unity stage is exact.
+    const unsigned int stageMask = leftEQ.getBlockStageMask(leftTarget) | rightEQ.getBlockStageMask(rightTarget);
+    const float step = 1.0f / static_cast<float>(numSamples);
+
+    CascadeStage<StereoLanes> stages[maxBands];
+    int stageBands[maxBands];
+    int numStages = 0;
+    for (int band = 0; band < maxBands; ++band)
+    {
+        if ((stageMask & (1u << band)) == 0)
+            continue;
+
+        const BiquadFilter& l = leftEQ.filters[band];
+        const BiquadFilter& r = rightEQ.filters[band];
+        const BiquadCoefficients& lt = leftTarget != nullptr ? leftTarget->bands[band] : l;
+        const BiquadCoefficients& rt = rightTarget != nullptr ? rightTarget->bands[band] : r;
+
+        auto& stage = stages[numStages];
+        stage.b0 = StereoLanes::make(l.b0, r.b0);  stage.db0 = StereoLanes::make((lt.b0 - l.b0) * step, (rt.b0 - r.b0) * step);
+        stage.b1 = StereoLanes::make(l.b1, r.b1);  stage.db1 = StereoLanes::make((lt.b1 - l.b1) * step, (rt.b1 - r.b1) * step);
+        stage.b2 = StereoLanes::make(l.b2, r.b2);  stage.db2 = StereoLanes::make((lt.b2 - l.b2) * step, (rt.b2 - r.b2) * step);
+        stage.a1 = StereoLanes::make(l.a1, r.a1);  stage.da1 = StereoLanes::make((lt.a1 - l.a1) * step, (rt.a1 - r.a1) * step);
+        stage.a2 = StereoLanes::make(l.a2, r.a2);  stage.da2 = StereoLanes::make((lt.a2 - l.a2) * step, (rt.a2 - r.a2) * step);
+        stage.s1 = StereoLanes::make(l.s1, r.s1);
+        stage.s2 = StereoLanes::make(l.s2, r.s2);
+        stageBands[numStages++] = band;
+    }
+
+    if (numStages > 0)
+    {
+        if (midSide)
+        {
+            auto load = [left, right](int i) { return StereoLanes::make(0.5f * (left[i] + right[i]), 0.5f * (left[i] - right[i])); };
+            auto store = [left, right](int i, StereoLanes value)
+            {
+                float mid, side;
+                value.store(&mid, &side);
+                left[i] = mid + side;
+                right[i] = mid - side;
+            };
+            runRampedCascade(stages, numStages, numSamples, load, store);
+        }
+        else
+        {
+            auto load = [left, right](int i) { return StereoLanes::load(left + i, right + i); };
+            auto store = [left, right](int i, StereoLanes value) { value.store(left + i, right + i); };
+            runRampedCascade(stages, numStages, numSamples, load, store);
+        }
+    }
+
+    for (int i = 0; i < numStages; ++i)
+    {
+        const int band = stageBands[i];
+        leftEQ.filters[band].s1 = stages[i].s1.lane(0);
+        leftEQ.filters[band].s2 = stages[i].s2.lane(0);
+        rightEQ.filters[band].s1 = stages[i].s1.lane(1);
+        rightEQ.filters[band].s2 = stages[i].s2.lane(1);
+    }
+
+    if (leftTarget != nullptr)
+        leftEQ.applyCoefficients(*leftTarget);
+    if (rightTarget != nullptr)
+        rightEQ.applyCoefficients(*rightTarget);
+}
+
+void IIRFilterProcessor::setPhaseMode(PhaseMode mode)
+{
+    const bool linear = mode == PhaseMode::LinearPhase;
+    if (linearPhaseSelected.exchange(linear) == linear)
+        return;
+
+    // The FIR is only kept up to date while linear phase is selected
+    if (linear)
+        publishCoefficients();
+}
+
+double IIRFilterProcessor::getCascadeMagnitude(const BiquadCoefficients* coefficients, int numBandsToUse, double omega)
+{
+    const std::complex<double> z1 = std::polar(1.0, -omega);
+    const std::complex<double> z2 = z1 * z1;
+
+    double magnitude = 1.0;
+    for (int band = 0; band < numBandsToUse; ++band)
+    {
+        const auto& c = coefficients[band];
+        if (isUnity(c))
+            continue;
+
+        magnitude *= std::abs((double) c.b0 + (double) c.b1 * z1 + (double) c.b2 * z2)
+                   / std::abs(1.0 + (double) c.a1 * z1 + (double) c.a2 * z2);
+    }
+    return magnitude;
+}
+
+float IIRFilterProcessor::getMagnitudeDb(float frequency) const
+{
+    const double omega = juce::MathConstants<double>::twoPi * frequency / currentSampleRate;
+    return static_cast<float>(20.0 * std::log10(juce::jmax(1.0e-12, getCascadeMagnitude(designedCoefficients, numBands, omega))));
+}
+
+int IIRFilterProcessor::getFirLength(double sampleRate)
+{
+    // About 6 Hz per bin, so low bands keep their shape through the window
+    return juce::nextPowerOfTwo(static_cast<int>(sampleRate / 6.0));
+}
+
+void IIRFilterProcessor::designLinearPhaseFir(const BiquadCoefficients* coefficients, double sampleRate)
+{
+    const int firLength = getFirLength(sampleRate);
+    const int order = juce::roundToInt(std::log2(firLength));
+    juce::dsp::FFT fft(order);
+
+    // Zero-phase spectrum: the cascade's magnitude at each bin, packed as JUCE's real-only layout
+    std::vector<float> spectrum(static_cast<size_t>(firLength) * 2, 0.0f);
+    for (int bin = 0; bin <= firLength / 2; ++bin)
+    {
+        const double omega = juce::MathConstants<double>::twoPi * bin / firLength;
+        spectrum[static_cast<size_t>(bin) * 2] = static_cast<float>(getCascadeMagnitude(coefficients, maxBands, omega));
+    }
+    fft.performRealOnlyInverseTransform(spectrum.data());
+
+    // Centre the symmetric response at firLength / 2 and taper it with a periodic Hann window
+    juce::AudioBuffer<float> impulseResponse(1, firLength);
+    auto* fir = impulseResponse.getWritePointer(0);
+    for (int i = 0; i < firLength; ++i)
+    {
+        const float window = 0.5f - 0.5f * std::cos(juce::MathConstants<float>::twoPi * i / firLength);
+        fir[i] = spectrum[static_cast<size_t>((i + firLength / 2) % firLength)] * window;
+    }
+
+    // Swapped in on the convolution's own background thread, with its crossfade
+    convolution.loadImpulseResponse(std::move(impulseResponse), sampleRate,
+                                    juce::dsp::Convolution::Stereo::no,
+                                    juce::dsp::Convolution::Trim::no,
+                                    juce::dsp::Convolution::Normalise::no);
+}
+
+bool IIRFilterProcessor::runLinearPhase(const float* input, int numSamples)
+{
+    if (linearPhaseSelected.load() && maxBlockSize > 0)
+    {
+        // Start from silence and let a full FIR length through before fading in
+        const int firLength = getFirLength(currentSampleRate);
+        if (!firRunning)
+        {
+            convolution.reset();
+            firRunning = true;
+            firWarmupSamples = firLength;
+        }
+
+        // The length is only counted once the designed FIR is in and the biquads have been delayed into
+        // line, so the fade covers audio that reached both paths the same way and fills the whole FIR
+        const bool aligned = !alignmentMix.isSmoothing() && alignmentMix.getCurrentValue() == 1.0f;
+        if (aligned && convolution.getCurrentIRSize() == firLength)
+        {
+            if (firWarmupSamples <= 0)
+                linearPhaseMix.setTargetValue(1.0f);
+            else
+                firWarmupSamples -= numSamples;
+        }
+    }
+    else
+    {
+        linearPhaseMix.setTargetValue(0.0f);
+        if (!linearPhaseMix.isSmoothing() && linearPhaseMix.getCurrentValue() == 0.0f)
+            firRunning = false;
+    }
+
+    if (!firRunning)
+        return false;
+
+    juce::FloatVectorOperations::copy(firBuffer.getWritePointer(0), input, numSamples);
+    juce::dsp::AudioBlock<float> block(firBuffer);
+    auto subBlock = block.getSubBlock(0, static_cast<size_t>(numSamples));
+    convolution.process(juce::dsp::ProcessContextReplacing<float>(subBlock));
+    return true;
+}
+
+void IIRFilterProcessor::delayMinimumPhase(float* data, int numSamples)
+{
+    // Needed from the switch to linear phase until the FIR has faded out again after the switch back
+    const bool wanted = linearPhaseSelected.load() || firRunning;
+    const int length = static_cast<int>(alignmentDelay.size());
+    if (length == 0 || (!alignmentRunning && !wanted))
+        return;
+
+    if (!alignmentRunning)
+    {
+        std::fill(alignmentDelay.begin(), alignmentDelay.end(), 0.0f);
+        alignmentIndex = 0;
+        alignmentRunning = true;
+        alignmentFillSamples = length;
+    }
+
+    // The delayed copy only fades in once the ring holds audio, and fades out before the delay stops,
+    // so the jump in time is covered by a crossfade rather than a gap or a click
+    if (alignmentFillSamples > 0)
+        alignmentFillSamples -= numSamples;
+    else
+        alignmentMix.setTargetValue(wanted ? 1.0f : 0.0f);
+
+    float* undelayed = undelayedBuffer.data();
+    juce::FloatVectorOperations::copy(undelayed, data, numSamples);
+
+    // Swapping the block through the ring writes it in and reads out what went in a delay ago
+    for (int done = 0; done < numSamples;)
+    {
+        const int count = juce::jmin(numSamples - done, length - alignmentIndex);
+        std::swap_ranges(data + done, data + done + count, alignmentDelay.data() + alignmentIndex);
+        done += count;
+        alignmentIndex = (alignmentIndex + count) % length;
+    }
+
+    if (alignmentMix.isSmoothing())
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float mix = alignmentMix.getNextValue();
+            data[i] = undelayed[i] + mix * (data[i] - undelayed[i]);
+        }
+    }
+    else if (alignmentMix.getCurrentValue() == 0.0f)
+    {
+        juce::FloatVectorOperations::copy(data, undelayed, numSamples);
+        alignmentRunning = wanted;
+    }
+}
+
+void IIRFilterProcessor::mixLinearPhase(float* data, int numSamples)
+{
+    const auto* fir = firBuffer.getReadPointer(0);
+
+    if (!linearPhaseMix.isSmoothing())
+    {
+        if (linearPhaseMix.getCurrentValue() == 1.0f)
+            juce::FloatVectorOperations::copy(data, fir, numSamples);
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float mix = linearPhaseMix.getNextValue();
+        data[i] += mix * (fir[i] - data[i]);
+    }
+}
+
+void IIRFilterProcessor::updateBand(int bandIndex, FilterType type, float freq, float gain, float Q)
+{
+    if (bandIndex < 0 || bandIndex >= maxBands)
         return;
         
     bandParams[bandIndex].type = type;
@@ -180,7 +1088,8 @@ void IIRFilterProcessor::updateBand(int bandIndex, const juce::String& type, flo
     bandParams[bandIndex].gain = gain;
     bandParams[bandIndex].Q = Q;
     
-    designFilter(&filters[bandIndex], type, freq, gain, Q, currentSampleRate);
+    designFilter(&designedCoefficients[bandIndex], type, freq, gain, Q, currentSampleRate);
+    publishCoefficients();
 }
 
 void IIRFilterProcessor::setSampleRate(float sampleRate)
@@ -188,18 +1097,34 @@ void IIRFilterProcessor::setSampleRate(float sampleRate)
     currentSampleRate = sampleRate;
     
     // Redesign all filters with new sample rate
-    for (int i = 0; i < 7; ++i)
+    for (int i = 0; i < maxBands; ++i)
     {
-        designFilter(&filters[i], bandParams[i].type, bandParams[i].freq, 
+        designFilter(&designedCoefficients[i], bandParams[i].type, bandParams[i].freq, 
                     bandParams[i].gain, bandParams[i].Q, currentSampleRate);
     }
+    publishCoefficients();
+}
+
+void IIRFilterProcessor::setNumBands(int numBandsToUse)
+{
+    numBands = juce::jlimit(1, maxBands, numBandsToUse);
+    publishCoefficients();
 }
 
 void IIRFilterProcessor::reset()
 {
-    for (int i = 0; i < 7; ++i)
+    for (int i = 0; i < maxBands; ++i)
     {
-        filters[i].x1 = filters[i].x2 = 0.0f;
-        filters[i].y1 = filters[i].y2 = 0.0f;
+        filters[i].s1 = filters[i].s2 = 0.0f;
     }
-}
\ No newline at end of file
+
+    convolution.reset();
+    linearPhaseMix.setCurrentAndTargetValue(0.0f);
+    firRunning = false;
+    firWarmupSamples = 0;
+    std::fill(alignmentDelay.begin(), alignmentDelay.end(), 0.0f);
+    alignmentIndex = 0;
+    alignmentRunning = false;
+    alignmentFillSamples = 0;
+    alignmentMix.setCurrentAndTargetValue(0.0f);
+}
@@ -1,48 +1,197 @@
 #pragma once
 #include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
 
+// Parametric biquad EQ of up to 32 bands, 7 by default.
+// Coefficients are designed on the message thread and handed to the audio thread through a lock-free
+// triple buffer; the audio thread swaps them in at block boundaries without touching the filter state.
+// Each published set carries the list of bands that do real work, so unity bands cost nothing.
+// In linear-phase mode the same bands' magnitude response is designed into a symmetric FIR on a
+// background thread and run through juce::dsp::Convolution (uniformly partitioned, zero added
+// latency beyond the FIR's own half length). Minimum phase has no latency. While linear phase is in
+// use, the biquads' output is faded over to a copy delayed by the FIR's half length as the FIR fills,
+// so the crossfade between the two modes is between aligned signals.
 class IIRFilterProcessor
 {
 public:
-    struct BiquadFilter
+    static constexpr int maxBands = 32;
+    static constexpr int defaultNumBands = 7;
+
+    enum class FilterType
+    {
+        Bypass,
+        Peak,
+        LowShelf,
+        HighShelf,
+        LowPass,
+        HighPass
+    };
+
+    // Maps the EQ window's type names ("PEQ", "LSH", "HSH", "LPF", "HPF"); anything else is Bypass
+    static FilterType filterTypeFromName(const juce::String& name);
+    static juce::String getFilterTypeName(FilterType type); // "" for Bypass
+
+    enum class PhaseMode
     {
-        float b0, b1, b2, a1, a2;
-        float x1, x2, y1, y2;
-        
-        BiquadFilter() : b0(1.0f), b1(0.0f), b2(0.0f), a1(0.0f), a2(0.0f),
-                        x1(0.0f), x2(0.0f), y1(0.0f), y2(0.0f) {}
+        MinimumPhase,
+        LinearPhase
+    };
+
+    // How processStereoBlock routes a channel pair: left and right as they are, or mid (L + R) / 2
+    // through the left EQ and side (L - R) / 2 through the right, decoded back to left and right
+    enum class StereoMode
+    {
+        LeftRight,
+        MidSide
+    };
+
+    struct BiquadCoefficients
+    {
+        float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+    };
+
+    // Transposed direct form II: coefficients plus two state values per band
+    struct BiquadFilter : BiquadCoefficients
+    {
+        float s1 = 0.0f, s2 = 0.0f;
     };
 
     IIRFilterProcessor();
-    ~IIRFilterProcessor() = default;
+    ~IIRFilterProcessor();
+
+    // Sample rate plus the block buffers and alignment delay for linear-phase mode (audio stopped)
+    void prepare(double sampleRate, int maximumBlockSize);
 
-    void initBiquadFilter(BiquadFilter* filter, float b0, float b1, float b2, float a1, float a2);
-    float processBiquadFilter(BiquadFilter* filter, float input);
-    void designFilter(BiquadFilter* filter, const juce::String& type, float freq, float gain, float Q, float sampleRate);
+    static void initBiquadFilter(BiquadCoefficients* filter, float b0, float b1, float b2, float a1, float a2);
+    static void designFilter(BiquadCoefficients* filter, FilterType type, float freq, float gain, float Q, float sampleRate);
     
-    // Process audio sample through all 7 EQ bands
-    float processEQ(float input);
+    // Process a block in place through the EQ bands.
+    // Steady blocks run the cascade as a wavefront: four consecutive stages sit in the lanes of one
+    // SIMD register (SSE2 or NEON, scalar otherwise), each a sample behind the one before, so the
+    // stages are independent within a step. Blocks that ramp to new coefficients run stage by stage.
+    void processBlock(float* data, int numSamples);
+
+    // Process a stereo block in place, left through leftEQ and right through rightEQ, or mid and side
+    // when leftEQ is in MidSide mode. The channels' wavefronts run in the same loop; ramping blocks put
+    // both channels in one register per band. The mid/side matrix is applied as samples enter and
+    // leave the kernel, so it costs no extra pass; only a running FIR needs the encoded block in memory.
+    static void processStereoBlock(IIRFilterProcessor& leftEQ, IIRFilterProcessor& rightEQ,
+                                   float* left, float* right, int numSamples);
     
-    // Update EQ parameters
-    void updateBand(int bandIndex, const juce::String& type, float freq, float gain, float Q);
+    // Update EQ parameters (message thread, or while audio is stopped)
+    void updateBand(int bandIndex, FilterType type, float freq, float gain, float Q);
     void setSampleRate(float sampleRate);
+
+    // Bands from numBandsToUse up keep their parameters but are left out of the cascade (message thread)
+    void setNumBands(int numBandsToUse);
+    int getNumBands() const { return numBands; }
+
+    // Magnitude of the designed bands in dB at frequency, whatever the phase mode (message thread)
+    float getMagnitudeDb(float frequency) const;
+
+    // Ramp coefficients linearly across the block that picks up a new set, instead of switching at once
+    void setCoefficientInterpolation(bool shouldInterpolate) { interpolateCoefficients.store(shouldInterpolate); }
+
+    // Message thread. The audio thread starts the FIR and fades the biquads over to their delayed copy,
+    // lets the FIR fill, then crossfades to it over crossfadeSeconds; switching back crossfades to the
+    // delayed biquads, which keep running throughout, then back to the undelayed ones.
+    void setPhaseMode(PhaseMode mode);
+    PhaseMode getPhaseMode() const { return linearPhaseSelected.load() ? PhaseMode::LinearPhase : PhaseMode::MinimumPhase; }
+
+    // Latency of processBlock in the selected phase mode: half the FIR length at the prepared rate in
+    // linear phase, 0 in minimum phase and before prepare
+    int getLatencySamples() const { return linearPhaseSelected.load() ? static_cast<int>(alignmentDelay.size()) : 0; }
+
+    // Message thread; read from the left processor of a stereo pair
+    void setStereoMode(StereoMode mode) { midSideSelected.store(mode == StereoMode::MidSide); }
+    StereoMode getStereoMode() const { return midSideSelected.load() ? StereoMode::MidSide : StereoMode::LeftRight; }
     
     // Reset filter states
     void reset();
 
 private:
-    BiquadFilter filters[7];
+    // Audio thread: filters in use, coefficients and state.
+    // Bands outside activeBands hold unity coefficients and zero state, which passes audio through exactly.
+    BiquadFilter filters[maxBands];
+    int activeBands[maxBands] = {};
+    int numActiveBands = 0;
     float currentSampleRate;
+
+    // Message thread: the latest design, published as a whole set
+    BiquadCoefficients designedCoefficients[maxBands];
+    int numBands = defaultNumBands;
+    std::array<BiquadCoefficients, maxBands> firDesignCoefficients {}; // What the last FIR was designed from
+    double firDesignSampleRate = 0.0;
+
+    // Triple buffer: the writer owns one set, the reader one, and the third is shared.
+    // sharedSet holds the shared index, plus newSetFlag while the reader has not taken it yet.
+    struct CoefficientSet
+    {
+        BiquadCoefficients bands[maxBands];
+        int activeBands[maxBands] = {}; // Non-unity bands in order, compiled when the set is published
+        int numActiveBands = 0;
+    };
+
+    static constexpr int newSetFlag = 4;
+    CoefficientSet coefficientSets[3];
+    int writerSet = 0;
+    int readerSet = 2;
+    std::atomic<int> sharedSet { 1 };
+    std::atomic<bool> interpolateCoefficients { true };
+    std::atomic<bool> midSideSelected { false };
+
+    // Linear phase
+    static constexpr double crossfadeSeconds = 0.05;
+    static int getFirLength(double sampleRate);
+    static double getCascadeMagnitude(const BiquadCoefficients* coefficients, int numBandsToUse, double omega);
+    void designLinearPhaseFir(const BiquadCoefficients* coefficients, double sampleRate);
+    bool runLinearPhase(const float* input, int numSamples); // True if the FIR output is in firBuffer
+    bool isLinearPhaseRunning() const { return firRunning || (linearPhaseSelected.load() && maxBlockSize > 0); }
+    void mixLinearPhase(float* data, int numSamples);
+    void delayMinimumPhase(float* data, int numSamples); // Lines the biquads' output up with the FIR's while it runs
+
+    std::atomic<bool> linearPhaseSelected { false };
+    juce::dsp::Convolution convolution;          // Zero latency, uniformly partitioned
+    juce::AudioBuffer<float> firBuffer;          // Audio thread: the block's input, convolved in place
+    juce::SmoothedValue<float> linearPhaseMix;   // Audio thread: 0 = biquads, 1 = FIR
+    bool firRunning = false;                     // Audio thread
+    int firWarmupSamples = 0;                    // Audio thread: input still needed to fill the FIR
+    std::vector<float> alignmentDelay;           // Audio thread: the biquads' output, half the FIR length behind
+    int alignmentIndex = 0;
+    bool alignmentRunning = false;               // Audio thread: the delay is being fed
+    int alignmentFillSamples = 0;                // Audio thread: output still needed before the delay holds audio
+    juce::SmoothedValue<float> alignmentMix;     // Audio thread: 0 = biquads as they are, 1 = delayed
+    std::vector<float> undelayedBuffer;          // Audio thread: the block's biquad output while fading the delay
+    int maxBlockSize = 0;
+
+    void publishCoefficients();
+    const CoefficientSet* acquireCoefficients(); // Newly published set, or nullptr
+    void applyCoefficients(const CoefficientSet& set);
+
+    // Takes up a newly published set at the start of a block. Returns the set to ramp towards
+    // across the block, or nullptr if the coefficients stay as they are.
+    const CoefficientSet* beginBlock();
+    unsigned int getBlockStageMask(const CoefficientSet* target) const; // Bit per band the block has to run
+    static void rampStereoBlock(IIRFilterProcessor& leftEQ, IIRFilterProcessor& rightEQ,
+                                const CoefficientSet* leftTarget, const CoefficientSet* rightTarget,
+                                float* left, float* right, int numSamples, bool midSide);
     
     // Default EQ band parameters
     struct EQBandParams
     {
-        juce::String type;
+        FilterType type;
         float freq;
         float gain;
         float Q;
     };
     
-    EQBandParams bandParams[7];
+    EQBandParams bandParams[maxBands];
     void initializeDefaultParams();
-};
\ No newline at end of file
+
+    // Background FIR designs; the destructor waits for a running one
+    juce::ThreadPool firDesignPool { 1 };
+
+    friend class IIRFilterProcessorTests;
+};
@@ -0,0 +1,125 @@
+#include "IIRFilterProcessor.h"
+#include <optional>
+
+// Run with AudioEffectTools --run-tests
+class IIRFilterProcessorTests : public juce::UnitTest
+{
+public:
+    IIRFilterProcessorTests() : juce::UnitTest("IIRFilterProcessor", "EffectJUCE") {}
+
+    void runTest() override
+    {
+        // Flat bands, so either path passes an impulse through unchanged apart from the delay
+        IIRFilterProcessor eq;
+        eq.prepare(sampleRate, blockSize);
+
+        beginTest("Minimum phase has no latency");
+        expectEquals(eq.getLatencySamples(), 0);
+        expectTransients(eq, 4096, {}, { { 1000, 1000 }, { 3000, 3000 } });
+
+        beginTest("Linear phase reports the FIR's latency");
+        eq.setPhaseMode(IIRFilterProcessor::PhaseMode::LinearPhase);
+        const int latency = eq.getLatencySamples();
+        expectEquals(latency, 4096);
+
+        // The FIR is designed and swapped into the convolution on background threads; wait for it,
+        // then run the switch to linear phase to its end and back again through silence
+        expect(waitForFir(eq), "the FIR was never installed");
+        runSilence(eq, 48000);
+        eq.setPhaseMode(IIRFilterProcessor::PhaseMode::MinimumPhase);
+        runSilence(eq, 48000);
+
+        // The fades are counted in samples from here on, and the FIR is already in place
+        beginTest("Impulses across the switch to linear phase come out once, at each side's latency");
+        expectTransients(eq, 8192, IIRFilterProcessor::PhaseMode::LinearPhase,
+                         { { 7000, 7000 },
+                           { 8192 + 11000, 8192 + 11000 + latency },   // While the FIR fades in
+                           { 8192 + 11600, 8192 + 11600 + latency },
+                           { 8192 + 12200, 8192 + 12200 + latency },
+                           { 8192 + 24000, 8192 + 24000 + latency } });
+
+        beginTest("Impulses across the switch to minimum phase come out once, at each side's latency");
+        expectTransients(eq, 8192, IIRFilterProcessor::PhaseMode::MinimumPhase,
+                         { { 8192 - 3500, 8192 - 3500 + latency },    // While the FIR fades out
+                           { 8192 - 2900, 8192 - 2900 + latency },
+                           { 8192 - 2300, 8192 - 2300 + latency },
+                           { 8192 + 6000, 8192 + 6000 },
+                           { 8192 + 7000, 8192 + 7000 } });
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 512;
+
+    struct Transient
+    {
+        int input, output;
+    };
+
+    static void runSilence(IIRFilterProcessor& eq, int numSamples)
+    {
+        juce::AudioBuffer<float> block(1, blockSize);
+        for (int done = 0; done < numSamples; done += blockSize)
+        {
+            block.clear();
+            eq.processBlock(block.getWritePointer(0), blockSize);
+        }
+    }
+
+    static bool waitForFir(IIRFilterProcessor& eq)
+    {
+        // The convolution takes up a loaded FIR in process, so silence keeps running while waiting
+        const int firLength = IIRFilterProcessor::getFirLength(sampleRate);
+        const auto deadline = juce::Time::getMillisecondCounter() + 10000;
+        while (eq.convolution.getCurrentIRSize() != firLength)
+        {
+            if (juce::Time::getMillisecondCounter() > deadline)
+                return false;
+
+            runSilence(eq, blockSize);
+            juce::Thread::sleep(1);
+        }
+        return true;
+    }
+
+    // Feeds impulses through the EQ, switching phase mode at switchAt, and checks each comes out as
+    // a single unit transient where expected and nothing else does; the fades between the two
+    // latencies repeat or drop audio, so no impulse goes in while they run
+    void expectTransients(IIRFilterProcessor& eq, int switchAt, std::optional<IIRFilterProcessor::PhaseMode> mode,
+                          std::initializer_list<Transient> transients)
+    {
+        int length = switchAt;
+        for (const auto& transient : transients)
+            length = juce::jmax(length, transient.output + blockSize);
+
+        std::vector<float> signal(static_cast<size_t>(length), 0.0f);
+        for (const auto& transient : transients)
+            signal[static_cast<size_t>(transient.input)] = 1.0f;
+
+        for (int start = 0; start < length; start += blockSize)
+        {
+            if (start == switchAt && mode.has_value())
+                eq.setPhaseMode(*mode);
+            eq.processBlock(signal.data() + start, juce::jmin(blockSize, length - start));
+        }
+
+        float strayPeak = 0.0f;
+        for (int i = 0; i < length; ++i)
+        {
+            bool expected = false;
+            for (const auto& transient : transients)
+                expected = expected || i == transient.output;
+
+            if (expected)
+                expectWithinAbsoluteError(signal[static_cast<size_t>(i)], 1.0f, 1.0e-3f);
+            else
+                strayPeak = juce::jmax(strayPeak, std::abs(signal[static_cast<size_t>(i)]));
+        }
+        expectLessThan(strayPeak, 1.0e-3f, "energy outside the expected transients");
+
+        // Whatever the fades left behind has drained before the next test
+        runSilence(eq, 48000);
+    }
+};
+
+static IIRFilterProcessorTests iirFilterProcessorTests;
@@ -1,6 +1,8 @@
 #pragma once
 #include <JuceHeader.h>
+#include <atomic>
 #include <cmath>
+#include <vector>
 
 class LimiterProcessor
 {
@@ -14,59 +16,229 @@ public:
     struct LimiterParams
     {
         float threshold = 0.0f;    // dBFS (-60 to 0)
-        float ratio = 10.0f;       // 1:1 to 20:1
+        float ratio = 10.0f;       // 1:1 to 20:1 (RMS limiter only; the peak limiter is always a brickwall)
         float attack = 50.0f;      // ms (1 to 100)
         float release = 200.0f;    // ms (10 to 1000)
         bool enabled = false;
+        int oversamplingOrder = 0; // 0 = off, 1-3 = 2x/4x/8x (peak limiter only)
+        float lookahead = 1.0f;    // ms (0.5 to 5), how far the peak limiter sees ahead; it is also its attack time
+        float window = 10.0f;      // ms (1 to 100), RMS detector averaging window (RMS limiter only)
+        float link = 100.0f;       // % (0 to 100): 0 limits each channel on its own level, 100 all on the loudest
     };
 
+    static constexpr int maxOversamplingOrder = 3;
+    static constexpr float maxRMSWindowMs = 100.0f;
+    static constexpr float maxLookaheadMs = 5.0f;
+
     LimiterProcessor();
     ~LimiterProcessor() = default;
 
-    // Process audio sample
-    float processLimiter(float input);
+    // Allocates the oversampling buffers, the RMS history and the lookahead delay; call before processBlock
+    void prepare(double sampleRate, int maximumBlockSize);
+
+    // Process a block in place; the peak stage runs at the oversampled rate when enabled.
+    // Each channel has its own detectors and envelope, tied together by the stage's link amount.
+    // The peak stage is a brickwall true-peak limiter: it measures 4x oversampled peaks as in ITU-R BS.1770
+    // and delays the audio by its lookahead, so the gain has already ramped down when a peak arrives.
+    // Its ratio is ignored. At 1x the output's true peak stays at the threshold; with oversampling
+    // the downsampling filters can move the peaks again.
+    void processBlock(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples);
     
-    // Update parameters
+    // Update parameters (message thread); processBlock takes them up at the start of its next block
     void setRMSParams(const LimiterParams& params);
     void setPeakParams(const LimiterParams& params);
     void setSampleRate(float sampleRate);
+
+    // Latency of the peak limiter's oversampling filters and lookahead, in samples at the host rate
+    int getLatencySamples(int oversamplingOrder, float lookaheadMs) const;
+
+    // Latency at the current settings: the oversampling filters, which run whether or not the peak
+    // stage is enabled, plus its lookahead while it is
+    int getLatencySamples() const;
     
-    // Enable/disable limiters
-    void setRMSEnabled(bool enabled) { rmsParams.enabled = enabled; }
-    void setPeakEnabled(bool enabled) { peakParams.enabled = enabled; }
+    // Enable/disable limiters (message thread)
+    void setRMSEnabled(bool enabled) { editedRMSParams.enabled = enabled; publishParams(); }
+    void setPeakEnabled(bool enabled) { editedPeakParams.enabled = enabled; publishParams(); }
     
-    // Get current parameters
-    const LimiterParams& getRMSParams() const { return rmsParams; }
-    const LimiterParams& getPeakParams() const { return peakParams; }
+    // Get current parameters (message thread): the latest set, whether or not the audio thread has it yet
+    const LimiterParams& getRMSParams() const { return editedRMSParams; }
+    const LimiterParams& getPeakParams() const { return editedPeakParams; }
+
+    // Levels for meters, in dB. Peaks and gain reduction are the largest since the previous call,
+    // so a meter polling slower than the audio blocks misses none; RMS levels are the latest block's.
+    struct MeterReadings
+    {
+        float inputPeak = -100.0f;      // dBFS, loudest channel, before both stages
+        float inputRMS = -100.0f;
+        float outputPeak = -100.0f;     // After both stages
+        float outputRMS = -100.0f;
+        float rmsGainReduction = 0.0f;  // dB, positive
+        float peakGainReduction = 0.0f;
+    };
+
+    // Message thread; processBlock publishes through atomics and never waits for it
+    MeterReadings takeMeterReadings();
 
 private:
-    // Limiter state
+    // Limiter state, per channel
     struct LimiterState
     {
+        float envelope[2] = {};  // Smoothed gain reduction, log2 of amplitude
+    };
+
+    // Gain computer constants in log2 units, recomputed only when the parameters or the rate change
+    struct StageCoefficients
+    {
+        float thresholdLog2 = 0.0f;
+        float slope = 0.0f;         // Gain reduction per unit of level above threshold
+        float attack = 0.0f;
+        float release = 0.0f;
+
+        // What they were computed from
+        float threshold = 0.0f, ratio = 0.0f, attackMs = -1.0f, releaseMs = -1.0f, sampleRate = 0.0f;
+    };
+
+    // Sliding-window sum: a running sum over a ring, re-summed exactly once per pass through the ring
+    // so rounding cannot build up. Gives the RMS detector its mean square and the lookahead its ramp.
+    struct SlidingSum
+    {
+        std::vector<float> history;     // Sized for the longest window
+        double sum = 0.0;               // Of the newest `length` entries
+        int length = 1;                 // Window in samples
+        int writeIndex = 0;
+        int entriesSinceResum = 0;
+    };
+
+    // Sliding-window maximum: a monotonic deque in a ring. Each value is pushed and popped once,
+    // and the front is always the largest of the newest `length` values.
+    struct SlidingMax
+    {
+        std::vector<float> values;      // Sized for the longest window
+        std::vector<juce::int64> positions;
+        int front = 0;
+        int size = 0;
+        int length = 1;
+        juce::int64 position = 0;       // Of the next value pushed
+    };
+
+    // Gain reduction of one peak channel, log2 of amplitude: the required reduction is held over the
+    // lookahead, averaged over it into a ramp that reaches full depth as the peak leaves the delay, then released
+    struct LookaheadGain
+    {
+        SlidingMax hold;
+        SlidingSum ramp;
         float envelope = 0.0f;
-        float rmsSum = 0.0f;
-        int rmsBufferIndex = 0;
-        static constexpr int rmsBufferSize = 512;
-        float rmsBuffer[rmsBufferSize] = {0.0f};
     };
 
+    // BS.1770 interpolator: 12 taps for each of 4 phases, peaking 6 samples back
+    static constexpr int truePeakTaps = 12;
+    static constexpr int truePeakDelay = 6;
+
+    struct PeakChannel
+    {
+        float history[truePeakTaps - 1] = {};  // The previous input, for the detector
+        std::vector<float> delay;              // The audio, lookahead plus twice the detector delay behind
+        int delayIndex = 0;
+        LookaheadGain gain;
+    };
+
+    // Message thread: the latest settings, published as a pair
+    LimiterParams editedRMSParams;
+    LimiterParams editedPeakParams;
+
+    // Triple buffer, as in IIRFilterProcessor: the writer owns one set, the reader one, and the third is shared.
+    // sharedSet holds the shared index, plus newSetFlag while the reader has not taken it yet.
+    struct ParamSet
+    {
+        LimiterParams rms, peak;
+    };
+
+    static constexpr int newSetFlag = 4;
+    ParamSet paramSets[3];
+    int writerSet = 0;
+    int readerSet = 2;
+    std::atomic<int> sharedSet { 1 };
+
+    void publishParams();
+    void acquireParams(); // Audio thread: takes up a newly published set, if there is one
+
+    // Audio thread: the settings in use
     LimiterParams rmsParams;
     LimiterParams peakParams;
     LimiterState rmsState;
-    LimiterState peakState;
+    StageCoefficients rmsCoefficients;
+    StageCoefficients peakCoefficients;
+    SlidingSum rmsDetectors[2];
+    PeakChannel peakChannels[2];
+    int lookaheadLength = 0;        // In samples at peakSampleRate; 0 until the first peak block
+    bool peakActive = false;        // Cleared while the peak stage is off, so it restarts from silence
+    bool peakGainShared = false;    // Channel 0's gain served both channels on the last chunk
+    SlidingMax mergedHold;          // Built by mergeLookaheadGains, then swapped in; sized like the channels' holds
+
+    // Published once per block, linear; takeMeterReadings swaps the peaks and gains back to their resting values
+    struct MeterValues
+    {
+        std::atomic<float> inputPeak { 0.0f }, inputRMS { 0.0f };
+        std::atomic<float> outputPeak { 0.0f }, outputRMS { 0.0f };
+        std::atomic<float> rmsGain { 1.0f }, peakGain { 1.0f };     // Lowest gain applied
+    };
+
+    MeterValues meterValues;
+    float rmsBlockGain = 1.0f;      // Lowest gain of the block being processed, per stage
+    float peakBlockGain = 1.0f;
+
+    // Per chunk scratch: each channel's level in log2, then its gain
+    static constexpr int chunkSize = 128;
+    float levels[2][chunkSize] = {};
+    float linkedLevels[chunkSize] = {};
+    float scratch[chunkSize] = {};
+    float truePeakInput[truePeakTaps - 1 + chunkSize] = {};
     
     float currentSampleRate = 44100.0f;
+    float peakSampleRate = 44100.0f; // currentSampleRate times the oversampling factor
+
+    // Polyphase IIR half-band filters, one per order, built up front so switching never allocates
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplers[maxOversamplingOrder];
+    int currentOversamplingOrder = 0;
+    int preparedBlockSize = 0;
     
     // Processing functions
-    float processRMSLimiter(float input);
-    float processPeakLimiter(float input);
+    template <int FixedChannels>
+    void processChannels(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples);
+    template <int FixedChannels>
+    void processRMSBlock(float* const* channels, int channelCount, int numSamples);
+    template <int FixedChannels>
+    void processPeakBlock(float* const* channels, int channelCount, int numSamples);
+    bool linkLevels(int channelCount, int count, float link);  // True when channel 0's level serves both
+    void applyGains(float* const* channels, int start, int channelCount, int count,
+                    const StageCoefficients& coefficients, LimiterState& state, float link, float& lowestGain);
+    void detectTruePeaks(PeakChannel& channel, const float* input, float* level, int count);
+    void delayAndApplyGains(PeakChannel& channel, float* samples, const float* gains, int count);
     
     // Helper functions
-    float calculateRMS();
-    void updateEnvelope(float& envelope, float targetLevel, float attackTime, float releaseTime);
+    void setRMSWindowLength();
+    void setLookaheadLength();
+    void resetPeakChannels();
+    void resetLookaheadGain(LookaheadGain& gain) const;
+    void mergeLookaheadGains(LookaheadGain& into, const LookaheadGain& from);  // Into keeps the deeper of the two
+    static void resumSlidingSum(SlidingSum& window);
+    static float pushSlidingSum(SlidingSum& window, float value);   // Returns the window's sum, including value
+    static float pushSlidingMax(SlidingMax& window, float value);   // Returns the window's maximum, including value
+    static void publishLevels(const juce::AudioBuffer<float>& buffer, int numChannels, int numSamples,
+                              std::atomic<float>& peak, std::atomic<float>& rms);
+    static void publishMaximum(std::atomic<float>& target, float value);
+    static void publishMinimum(std::atomic<float>& target, float value);
+
+    // Levels in log2 in, linear gains out, through the static curve and the attack/release filter
+    static void computeGains(float* values, int numValues, const StageCoefficients& coefficients, float& envelope);
+    // The same for the peak stage, through the lookahead hold and ramp and the release
+    static void computeLookaheadGains(float* values, int numValues, const StageCoefficients& coefficients,
+                                      LookaheadGain& gain);
+    static void applyStaticCurve(float* values, int numValues, const StageCoefficients& coefficients);
+    void updateCoefficients();
+    static void updateStageCoefficients(StageCoefficients& coefficients, const LimiterParams& params, float sampleRate);
     
-    // dB conversion helpers
-    static float dBToLinear(float dB) { return std::pow(10.0f, dB / 20.0f); }
+    // dB conversion helper
     static float linearTodB(float linear) 
     { 
         return (linear > 0.0f) ? 20.0f * std::log10(linear) : -100.0f; 
@@ -0,0 +1,360 @@
+#include "PitchShiftProcessor.h"
+
+namespace
+{
+    constexpr float twoPi = juce::MathConstants<float>::twoPi;
+
+    inline float wrapPhase(float x)
+    {
+        return x - twoPi * std::floor((x + juce::MathConstants<float>::pi) / twoPi);
+    }
+}
+
+void PitchShiftProcessor::prepare(double sampleRate, int maximumBlockSize)
+{
+    juce::ignoreUnused(maximumBlockSize); // Both engines stream sample by sample into fixed frames
+
+    currentSampleRate = sampleRate;
+
+    // Phase vocoder
+    fft = std::make_unique<juce::dsp::FFT>(fftOrder);
+    window.resize(fftSize);
+    for (int i = 0; i < fftSize; ++i)
+        window[static_cast<size_t>(i)] = 0.5f - 0.5f * std::cos(twoPi * static_cast<float>(i) / static_cast<float>(fftSize));
+
+    fftData.assign(2 * fftSize, 0.0f);
+    magnitude.assign(numBins, 0.0f);
+    phase.assign(numBins, 0.0f);
+    trueBin.assign(numBins, 0.0f);
+    shiftedReal.assign(numBins, 0.0f);
+    shiftedImag.assign(numBins, 0.0f);
+    peaks.assign(numBins, 0);
+
+    for (auto& channel : vocoder)
+    {
+        channel.inputFifo.assign(fftSize, 0.0f);
+        channel.outputFifo.assign(hopSize, 0.0f);
+        channel.accumulator.assign(2 * fftSize, 0.0f);
+        channel.lastPhase.assign(numBins, 0.0f);
+        channel.synthPhase.assign(numBins, 0.0f);
+    }
+
+    // WSOLA: the read head lives between min and max delay and jumps by about wsolaJump
+    wsolaOverlap = juce::jmax(16, juce::roundToInt(wsolaOverlapMs * 0.001 * sampleRate));
+    wsolaSearch = juce::jmax(8, juce::roundToInt(wsolaSearchMs * 0.001 * sampleRate));
+    wsolaJump = juce::jmax(wsolaSearch + wsolaOverlap, juce::roundToInt(wsolaJumpMs * 0.001 * sampleRate));
+
+    // Fading head may run a further overlap * (ratio - 1) towards the write position, ratio <= 2
+    wsolaMinDelay = static_cast<float>(2 * wsolaOverlap + 2);
+    wsolaMaxDelay = wsolaMinDelay + static_cast<float>(wsolaJump + wsolaSearch);
+
+    const int historySize = static_cast<int>(wsolaMaxDelay) + wsolaJump + wsolaSearch + 2 * wsolaOverlap + 4;
+    wsolaHistory.setSize(3, juce::nextPowerOfTwo(historySize));
+    wsolaMask = wsolaHistory.getNumSamples() - 1;
+
+    reset();
+}
+
+void PitchShiftProcessor::reset()
+{
+    currentMode = targetMode.load();
+    currentSemitones = juce::jlimit(-maxSemitones, maxSemitones, targetSemitones.load());
+    pitchRatio = std::pow(2.0f, currentSemitones / 12.0f);
+
+    resetVocoder();
+    resetWsola();
+}
+
+void PitchShiftProcessor::resetVocoder()
+{
+    for (auto& channel : vocoder)
+    {
+        std::fill(channel.inputFifo.begin(), channel.inputFifo.end(), 0.0f);
+        std::fill(channel.outputFifo.begin(), channel.outputFifo.end(), 0.0f);
+        std::fill(channel.accumulator.begin(), channel.accumulator.end(), 0.0f);
+        std::fill(channel.lastPhase.begin(), channel.lastPhase.end(), 0.0f);
+        std::fill(channel.synthPhase.begin(), channel.synthPhase.end(), 0.0f);
+    }
+
+    vocoderPosition = fftSize - hopSize;
+}
+
+void PitchShiftProcessor::resetWsola()
+{
+    wsolaHistory.clear();
+    wsolaWritePosition = 0;
+    wsolaDelay = static_cast<float>(getLatencySamples(WSOLA));
+    wsolaFadeDelay = wsolaDelay;
+    wsolaFadeRemaining = 0;
+}
+
+int PitchShiftProcessor::getLatencySamples(Mode mode) const
+{
+    if (mode == WSOLA)
+        return juce::roundToInt(0.5f * (wsolaMinDelay + wsolaMaxDelay));
+
+    // A sample waits up to fftSize - hopSize for its frame, then hopSize more in the output FIFO
+    return fftSize;
+}
+
+void PitchShiftProcessor::process(juce::AudioBuffer<float>& buffer, int numSamples)
+{
+    if (fft == nullptr || buffer.getNumChannels() < 2)
+        return;
+
+    // Pick up parameter changes once per block
+    const Mode mode = targetMode.load();
+    if (mode != currentMode)
+    {
+        currentMode = mode;
+        if (mode == WSOLA)
+            resetWsola();
+        else
+            resetVocoder();
+    }
+
+    const float semitones = juce::jlimit(-maxSemitones, maxSemitones, targetSemitones.load());
+    if (semitones != currentSemitones)
+    {
+        currentSemitones = semitones;
+        pitchRatio = std::pow(2.0f, semitones / 12.0f);
+    }
+
+    float* channels[2] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
+
+    if (currentMode == WSOLA)
+        processWsola(channels, numSamples);
+    else
+        processVocoder(channels, numSamples);
+}
+
+//==============================================================================
+// Phase vocoder
+
+void PitchShiftProcessor::processVocoder(float* const* channels, int numSamples)
+{
+    const int latency = fftSize - hopSize;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            auto& state = vocoder[ch];
+            state.inputFifo[static_cast<size_t>(vocoderPosition)] = channels[ch][i];
+            channels[ch][i] = state.outputFifo[static_cast<size_t>(vocoderPosition - latency)];
+        }
+
+        if (++vocoderPosition < fftSize)
+            continue;
+
+        vocoderPosition = latency;
+
+        for (auto& state : vocoder)
+        {
+            processVocoderFrame(state);
+
+            // Hand out one hop, then slide the accumulator and input frame
+            std::copy(state.accumulator.begin(), state.accumulator.begin() + hopSize, state.outputFifo.begin());
+            std::copy(state.accumulator.begin() + hopSize, state.accumulator.end(), state.accumulator.begin());
+            std::fill(state.accumulator.end() - hopSize, state.accumulator.end(), 0.0f);
+            std::copy(state.inputFifo.begin() + hopSize, state.inputFifo.end(), state.inputFifo.begin());
+        }
+    }
+}
+
+void PitchShiftProcessor::processVocoderFrame(VocoderChannel& channel)
+{
+    // Expected phase advance per hop for bin 1, and Hann^2 overlap-add gain at 4x overlap
+    const float expected = twoPi * static_cast<float>(hopSize) / static_cast<float>(fftSize);
+    const float overlapScale = 1.0f / 1.5f;
+    float* data = fftData.data();
+
+    // Analysis
+    juce::FloatVectorOperations::multiply(data, channel.inputFifo.data(), window.data(), fftSize);
+    juce::FloatVectorOperations::clear(data + fftSize, fftSize);
+    fft->performRealOnlyForwardTransform(data, true);
+
+    float peakFloor = 0.0f;
+    for (int k = 0; k < numBins; ++k)
+    {
+        const float re = data[2 * k];
+        const float im = data[2 * k + 1];
+        magnitude[static_cast<size_t>(k)] = std::sqrt(re * re + im * im);
+        phase[static_cast<size_t>(k)] = std::atan2(im, re);
+        peakFloor = juce::jmax(peakFloor, magnitude[static_cast<size_t>(k)]);
+
+        const float deviation = wrapPhase(phase[static_cast<size_t>(k)] - channel.lastPhase[static_cast<size_t>(k)] - expected * static_cast<float>(k));
+        channel.lastPhase[static_cast<size_t>(k)] = phase[static_cast<size_t>(k)];
+        trueBin[static_cast<size_t>(k)] = static_cast<float>(k) + deviation / expected;
+    }
+
+    // Peaks more than 100 dB below the frame maximum are left out
+    peakFloor *= 1.0e-5f;
+    int numPeaks = 0;
+    for (int k = 1; k < numBins - 1; ++k)
+    {
+        const float m = magnitude[static_cast<size_t>(k)];
+        if (m > peakFloor && m > magnitude[static_cast<size_t>(k - 1)] && m >= magnitude[static_cast<size_t>(k + 1)])
+            peaks[static_cast<size_t>(numPeaks++)] = k;
+    }
+
+    std::fill(shiftedReal.begin(), shiftedReal.end(), 0.0f);
+    std::fill(shiftedImag.begin(), shiftedImag.end(), 0.0f);
+
+    // Shift each peak's region of influence as a unit and rotate it by one phase (identity phase locking)
+    int regionStart = 0;
+    for (int p = 0; p < numPeaks; ++p)
+    {
+        const int peak = peaks[static_cast<size_t>(p)];
+        int regionEnd = numBins - 1;
+        if (p + 1 < numPeaks)
+        {
+            // Region boundary at the lowest bin between this peak and the next
+            const int next = peaks[static_cast<size_t>(p + 1)];
+            regionEnd = peak;
+            for (int k = peak + 1; k < next; ++k)
+                if (magnitude[static_cast<size_t>(k)] < magnitude[static_cast<size_t>(regionEnd)])
+                    regionEnd = k;
+            if (regionEnd == peak)
+                regionEnd = next - 1;
+        }
+
+        // Integer bin shift keeps the region intact; ratio 1 leaves the spectrum untouched
+        const float shiftedFrequency = trueBin[static_cast<size_t>(peak)] * pitchRatio;
+        const int shift = juce::roundToInt(shiftedFrequency - trueBin[static_cast<size_t>(peak)]);
+        const int target = peak + shift;
+
+        if (target > 0 && target < numBins)
+        {
+            // Advance the synthesis phase at the shifted frequency
+            const float synth = channel.synthPhase[static_cast<size_t>(target)] + expected * shiftedFrequency;
+            const float rotation = synth - phase[static_cast<size_t>(peak)];
+            const float c = std::cos(rotation);
+            const float s = std::sin(rotation);
+
+            const int first = juce::jmax(regionStart, -shift);
+            const int last = juce::jmin(regionEnd, numBins - 1 - shift);
+            for (int k = first; k <= last; ++k)
+            {
+                const float re = data[2 * k];
+                const float im = data[2 * k + 1];
+                shiftedReal[static_cast<size_t>(k + shift)] += re * c - im * s;
+                shiftedImag[static_cast<size_t>(k + shift)] += re * s + im * c;
+            }
+        }
+
+        regionStart = regionEnd + 1;
+    }
+
+    // Remember the phase actually produced per output bin for the next frame
+    for (int k = 0; k < numBins; ++k)
+    {
+        const float re = shiftedReal[static_cast<size_t>(k)];
+        const float im = shiftedImag[static_cast<size_t>(k)];
+        channel.synthPhase[static_cast<size_t>(k)] = (re != 0.0f || im != 0.0f) ? std::atan2(im, re) : 0.0f;
+        data[2 * k] = re;
+        data[2 * k + 1] = im;
+    }
+    juce::FloatVectorOperations::clear(data + 2 * numBins, 2 * fftSize - 2 * numBins);
+
+    // Synthesis (the inverse transform is already scaled by 1 / fftSize)
+    fft->performRealOnlyInverseTransform(data);
+    juce::FloatVectorOperations::multiply(data, window.data(), fftSize);
+    juce::FloatVectorOperations::addWithMultiply(channel.accumulator.data(), data, overlapScale, fftSize);
+}
+
+//==============================================================================
+// WSOLA
+
+float PitchShiftProcessor::readWsola(const float* history, float delay) const
+{
+    // Linear interpolation at (write position - delay)
+    const float position = static_cast<float>(wsolaWritePosition) - delay;
+    const int index = static_cast<int>(std::floor(position));
+    const float fraction = position - static_cast<float>(index);
+    const float s0 = history[index & wsolaMask];
+    const float s1 = history[(index + 1) & wsolaMask];
+    return s0 + fraction * (s1 - s0);
+}
+
+int PitchShiftProcessor::findWsolaJump(float fromDelay, int direction) const
+{
+    // Best match for the segment the current head is about to play, searched around the nominal jump
+    const float* mid = wsolaHistory.getReadPointer(2);
+    const int start = wsolaWritePosition - static_cast<int>(fromDelay);
+
+    int bestJump = wsolaJump;
+    float bestScore = -std::numeric_limits<float>::max();
+
+    for (int jump = wsolaJump - wsolaSearch; jump <= wsolaJump + wsolaSearch; ++jump)
+    {
+        const int candidate = start - direction * jump;
+        float correlation = 0.0f;
+        float energy = 1.0e-9f;
+
+        for (int k = 0; k < wsolaOverlap; ++k)
+        {
+            const float x = mid[(candidate + k) & wsolaMask];
+            correlation += x * mid[(start + k) & wsolaMask];
+            energy += x * x;
+        }
+
+        const float score = correlation / std::sqrt(energy);
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestJump = jump;
+        }
+    }
+
+    return bestJump;
+}
+
+void PitchShiftProcessor::processWsola(float* const* channels, int numSamples)
+{
+    float* historyL = wsolaHistory.getWritePointer(0);
+    float* historyR = wsolaHistory.getWritePointer(1);
+    float* historyMid = wsolaHistory.getWritePointer(2);
+
+    // The read head moves at the pitch ratio, so its delay drifts by (1 - ratio) per sample
+    const float drift = 1.0f - pitchRatio;
+    const float fadeStep = 1.0f / static_cast<float>(wsolaOverlap);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float inL = channels[0][i];
+        const float inR = channels[1][i];
+        historyL[wsolaWritePosition] = inL;
+        historyR[wsolaWritePosition] = inR;
+        historyMid[wsolaWritePosition] = 0.5f * (inL + inR);
+
+        // Splice once the head drifts out of range and no crossfade is running
+        if (wsolaFadeRemaining == 0 && (wsolaDelay < wsolaMinDelay || wsolaDelay > wsolaMaxDelay))
+        {
+            const int direction = wsolaDelay < wsolaMinDelay ? 1 : -1;
+            wsolaFadeDelay = wsolaDelay;
+            wsolaDelay += static_cast<float>(direction * findWsolaJump(wsolaDelay, direction));
+            wsolaFadeRemaining = wsolaOverlap;
+        }
+
+        float outL = readWsola(historyL, wsolaDelay);
+        float outR = readWsola(historyR, wsolaDelay);
+
+        if (wsolaFadeRemaining > 0)
+        {
+            // Raised-cosine crossfade from the old head to the new one
+            const float x = static_cast<float>(wsolaFadeRemaining) * fadeStep;
+            const float fadeOut = 0.5f - 0.5f * std::cos(juce::MathConstants<float>::pi * x);
+            outL += fadeOut * (readWsola(historyL, wsolaFadeDelay) - outL);
+            outR += fadeOut * (readWsola(historyR, wsolaFadeDelay) - outR);
+            wsolaFadeDelay += drift;
+            --wsolaFadeRemaining;
+        }
+
+        channels[0][i] = outL;
+        channels[1][i] = outR;
+
+        wsolaDelay += drift;
+        wsolaWritePosition = (wsolaWritePosition + 1) & wsolaMask;
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Stereo pitch shifter with two engines:
+//  - PhaseVocoder: STFT peak-region shifting with identity phase locking (best quality)
+//  - WSOLA: time-domain splicing aligned by cross-correlation (lower latency, best on monophonic material)
+class PitchShiftProcessor
+{
+public:
+    enum Mode
+    {
+        PhaseVocoder = 0,
+        WSOLA
+    };
+
+    PitchShiftProcessor() = default;
+    ~PitchShiftProcessor() = default;
+
+    // Allocate FFT, windows, frames and the WSOLA history; the only place that allocates
+    void prepare(double sampleRate, int maximumBlockSize);
+    void reset();
+
+    // Process stereo audio in place (channels 0 and 1)
+    void process(juce::AudioBuffer<float>& buffer, int numSamples);
+
+    // Update parameters (safe to call from the message thread)
+    void setSemitones(float semitones) { targetSemitones.store(semitones); }
+    void setMode(Mode mode) { targetMode.store(mode); }
+
+    // Latency in samples of the given mode at the prepared sample rate
+    int getLatencySamples(Mode mode) const;
+    int getLatencySamples() const { return getLatencySamples(targetMode.load()); }
+
+private:
+    // Phase vocoder framing: 2048-point FFT, 4x overlap
+    static constexpr int fftOrder = 11;
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int hopSize = fftSize / 4;
+    static constexpr int numBins = fftSize / 2 + 1;
+
+    // WSOLA timing in milliseconds
+    static constexpr double wsolaOverlapMs = 6.0;  // Crossfade and similarity window
+    static constexpr double wsolaSearchMs = 5.0;   // +/- alignment search around the nominal jump
+    static constexpr double wsolaJumpMs = 12.0;    // Nominal read-head jump
+
+    static constexpr float maxSemitones = 12.0f;
+
+    struct VocoderChannel
+    {
+        std::vector<float> inputFifo;     // Last fftSize input samples
+        std::vector<float> outputFifo;    // One hop of finished output
+        std::vector<float> accumulator;   // Overlap-add accumulator
+        std::vector<float> lastPhase;     // Analysis phase of the previous frame
+        std::vector<float> synthPhase;    // Synthesis phase of the previous frame
+    };
+
+    void processVocoder(float* const* channels, int numSamples);
+    void processVocoderFrame(VocoderChannel& channel);
+    void processWsola(float* const* channels, int numSamples);
+    int findWsolaJump(float fromDelay, int direction) const;
+    float readWsola(const float* history, float delay) const;
+    void resetVocoder();
+    void resetWsola();
+
+    double currentSampleRate = 44100.0;
+    Mode currentMode = PhaseVocoder;
+    float currentSemitones = 0.0f;
+    float pitchRatio = 1.0f;
+
+    std::atomic<float> targetSemitones { 0.0f };
+    std::atomic<Mode> targetMode { PhaseVocoder };
+
+    // Phase vocoder state
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> window;            // Periodic Hann, used for analysis and synthesis
+    std::vector<float> fftData;           // 2 * fftSize, interleaved complex
+    std::vector<float> magnitude;
+    std::vector<float> phase;
+    std::vector<float> trueBin;           // Instantaneous frequency in bins
+    std::vector<float> shiftedReal;
+    std::vector<float> shiftedImag;
+    std::vector<int> peaks;
+    VocoderChannel vocoder[2];
+    int vocoderPosition = 0;
+
+    // WSOLA state, one read head shared by both channels to keep the image stable
+    juce::AudioBuffer<float> wsolaHistory; // Channels 0/1 audio, channel 2 mid signal for correlation
+    int wsolaMask = 0;
+    int wsolaWritePosition = 0;
+    int wsolaOverlap = 0;
+    int wsolaSearch = 0;
+    int wsolaJump = 0;
+    float wsolaMinDelay = 0.0f;
+    float wsolaMaxDelay = 0.0f;
+    float wsolaDelay = 0.0f;              // Active read head
+    float wsolaFadeDelay = 0.0f;          // Read head being faded out
+    int wsolaFadeRemaining = 0;
+};
@@ -0,0 +1,97 @@
+#include "StereoDelayProcessor.h"
+
+void StereoDelayProcessor::prepare(double sampleRate, int maximumBlockSize, float maximumDelayMs)
+{
+    juce::ignoreUnused(maximumBlockSize); // Processing runs in fixed sub-blocks
+
+    currentSampleRate = sampleRate;
+    maxDelaySamples = static_cast<float>(maximumDelayMs * 0.001 * sampleRate);
+
+    // Power-of-two ring so the wrap is a mask; room for the longest delay plus interpolation
+    const int required = static_cast<int>(std::ceil(maxDelaySamples)) + subBlockSize + 2;
+    delayBuffer.setSize(2, juce::nextPowerOfTwo(required));
+    bufferMask = delayBuffer.getNumSamples() - 1;
+
+    delaySamples.reset(sampleRate, delaySmoothingSeconds);
+    feedback.reset(sampleRate, gainSmoothingSeconds);
+    mix.reset(sampleRate, gainSmoothingSeconds);
+
+    reset();
+}
+
+void StereoDelayProcessor::reset()
+{
+    delayBuffer.clear();
+    writePosition = 0;
+
+    const float delay = static_cast<float>(targetDelayMs.load() * 0.001 * currentSampleRate);
+    delaySamples.setCurrentAndTargetValue(juce::jlimit(minDelaySamples, juce::jmax(minDelaySamples, maxDelaySamples), delay));
+    feedback.setCurrentAndTargetValue(targetFeedback.load());
+    mix.setCurrentAndTargetValue(targetMix.load());
+}
+
+void StereoDelayProcessor::process(juce::AudioBuffer<float>& buffer, int numSamples)
+{
+    if (delayBuffer.getNumSamples() == 0 || buffer.getNumChannels() < 2)
+        return;
+
+    // Pick up parameter changes once per block
+    const float delay = static_cast<float>(targetDelayMs.load() * 0.001 * currentSampleRate);
+    delaySamples.setTargetValue(juce::jlimit(minDelaySamples, juce::jmax(minDelaySamples, maxDelaySamples), delay));
+    feedback.setTargetValue(juce::jlimit(0.0f, 0.99f, targetFeedback.load()));
+    mix.setTargetValue(juce::jlimit(0.0f, 1.0f, targetMix.load()));
+
+    float* channels[2] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
+
+    for (int start = 0; start < numSamples; start += subBlockSize)
+    {
+        const int count = juce::jmin(subBlockSize, numSamples - start);
+        float* subChannels[2] = { channels[0] + start, channels[1] + start };
+        processSubBlock(subChannels, count);
+    }
+}
+
+void StereoDelayProcessor::processSubBlock(float* const* channels, int numSamples)
+{
+    // Per-sample parameter ramps, shared by both channels
+    for (int i = 0; i < numSamples; ++i)
+    {
+        delayTimes[i] = delaySamples.getNextValue();
+        feedbackGains[i] = feedback.getNextValue();
+        mixGains[i] = mix.getNextValue();
+    }
+
+    const int bufferSize = bufferMask + 1;
+    const int firstPart = juce::jmin(numSamples, bufferSize - writePosition);
+
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        float* io = channels[channel];
+        float* memory = delayBuffer.getWritePointer(channel);
+
+        // Fractional read; delay >= sub-block length so only earlier sub-blocks are read
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float readPosition = static_cast<float>(writePosition + i) - delayTimes[i];
+            const int readFloor = static_cast<int>(std::floor(readPosition));
+            const float fraction = readPosition - static_cast<float>(readFloor);
+            const float s0 = memory[readFloor & bufferMask];
+            const float s1 = memory[(readFloor + 1) & bufferMask];
+            wet[i] = s0 + fraction * (s1 - s0);
+        }
+
+        // Feedback write: input + feedback * wet
+        juce::FloatVectorOperations::multiply(scratch, wet, feedbackGains, numSamples);
+        juce::FloatVectorOperations::add(scratch, io, numSamples);
+        juce::FloatVectorOperations::copy(memory + writePosition, scratch, firstPart);
+        if (firstPart < numSamples)
+            juce::FloatVectorOperations::copy(memory, scratch + firstPart, numSamples - firstPart);
+
+        // Dry/wet mix: dry + mix * (wet - dry)
+        juce::FloatVectorOperations::subtract(wet, io, numSamples);
+        juce::FloatVectorOperations::multiply(wet, mixGains, numSamples);
+        juce::FloatVectorOperations::add(io, wet, numSamples);
+    }
+
+    writePosition = (writePosition + numSamples) & bufferMask;
+}
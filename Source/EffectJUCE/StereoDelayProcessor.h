@@ -0,0 +1,53 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+
+// Stereo feedback delay with block processing and smoothed fractional delay time
+class StereoDelayProcessor
+{
+public:
+    StereoDelayProcessor() = default;
+    ~StereoDelayProcessor() = default;
+
+    // Allocate the delay memory; the only place that allocates
+    void prepare(double sampleRate, int maximumBlockSize, float maximumDelayMs = 2000.0f);
+    void reset();
+
+    // Process stereo audio in place (channels 0 and 1)
+    void process(juce::AudioBuffer<float>& buffer, int numSamples);
+
+    // Update parameters (safe to call from the message thread)
+    void setDelayTime(float delayMs) { targetDelayMs.store(delayMs); }
+    void setFeedback(float newFeedback) { targetFeedback.store(newFeedback); }
+    void setMix(float newMix) { targetMix.store(newMix); }
+
+private:
+    // Reads within a sub-block never reach samples written in the same sub-block
+    static constexpr int subBlockSize = 32;
+    static constexpr float delaySmoothingSeconds = 0.2f;
+    static constexpr float gainSmoothingSeconds = 0.02f;
+
+    void processSubBlock(float* const* channels, int numSamples);
+
+    juce::AudioBuffer<float> delayBuffer;
+    int bufferMask = 0;
+    int writePosition = 0;
+    float minDelaySamples = static_cast<float>(subBlockSize + 1);
+    float maxDelaySamples = 0.0f;
+    double currentSampleRate = 44100.0;
+
+    std::atomic<float> targetDelayMs { 500.0f };
+    std::atomic<float> targetFeedback { 0.3f };
+    std::atomic<float> targetMix { 0.5f };
+
+    juce::SmoothedValue<float> delaySamples;
+    juce::SmoothedValue<float> feedback;
+    juce::SmoothedValue<float> mix;
+
+    // Per sub-block scratch
+    float delayTimes[subBlockSize] = {};
+    float feedbackGains[subBlockSize] = {};
+    float mixGains[subBlockSize] = {};
+    float wet[subBlockSize] = {};
+    float scratch[subBlockSize] = {};
+};
@@ -0,0 +1,128 @@
+#include "EffectProcessor.h"
+
+EffectProcessor::EffectProcessor(const juce::String& effectName, std::vector<EffectParameter> effectParameters)
+    : name(effectName),
+      parameters(std::move(effectParameters)),
+      values(new std::atomic<float>[parameters.size()])
+{
+    for (size_t i = 0; i < parameters.size(); ++i)
+        values[i].store(parameters[i].defaultValue);
+}
+
+void EffectProcessor::setParameter(int index, float value)
+{
+    if (!juce::isPositiveAndBelow(index, static_cast<int>(parameters.size())))
+        return;
+
+    const auto& parameter = parameters[static_cast<size_t>(index)];
+    values[static_cast<size_t>(index)].store(juce::jlimit(parameter.minValue, parameter.maxValue, value));
+    parametersChanged.store(true);
+}
+
+float EffectProcessor::getParameter(int index) const
+{
+    if (!juce::isPositiveAndBelow(index, static_cast<int>(parameters.size())))
+        return 0.0f;
+
+    return values[static_cast<size_t>(index)].load();
+}
+
+void EffectProcessor::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    currentSpec = spec;
+    prepareEffect(spec);
+    parametersChanged.store(false);
+    updateParameters();
+
+    // Re-partitions the captured response for the new rate and block size
+    if (capturedConvolutions[0] != nullptr)
+        prepareCapturedConvolutions();
+}
+
+void EffectProcessor::reset()
+{
+    resetEffect();
+
+    for (auto& convolution : capturedConvolutions)
+        if (convolution != nullptr)
+            convolution->reset();
+}
+
+void EffectProcessor::process(const juce::dsp::AudioBlock<float>& block)
+{
+    if (captured.load())
+    {
+        // Each input runs through its paths to both outputs, then the two inputs' outputs add up
+        const auto numSamples = block.getNumSamples();
+        for (size_t input = 0; input < 2; ++input)
+        {
+            auto& paths = capturedPaths[input];
+            for (int output = 0; output < 2; ++output)
+                paths.copyFrom(output, 0, block.getChannelPointer(input), static_cast<int>(numSamples));
+
+            auto pathBlock = juce::dsp::AudioBlock<float>(paths).getSubBlock(0, numSamples);
+            capturedConvolutions[input]->process(juce::dsp::ProcessContextReplacing<float>(pathBlock));
+        }
+
+        auto output = block.getSubsetChannelBlock(0, 2);
+        output.copyFrom(juce::dsp::AudioBlock<float>(capturedPaths[0]).getSubBlock(0, numSamples));
+        output.add(juce::dsp::AudioBlock<float>(capturedPaths[1]).getSubBlock(0, numSamples));
+        return;
+    }
+
+    processAlgorithm(block);
+}
+
+void EffectProcessor::processAlgorithm(const juce::dsp::AudioBlock<float>& block)
+{
+    // Pick up parameter changes once per block
+    if (parametersChanged.exchange(false))
+        updateParameters();
+
+    processEffect(block);
+}
+
+void EffectProcessor::setCapturedResponse(juce::AudioBuffer<float>&& impulseResponse, double impulseSampleRate)
+{
+    jassert(impulseResponse.getNumChannels() == 4);
+    const int length = impulseResponse.getNumSamples();
+
+    for (int input = 0; input < 2; ++input)
+    {
+        auto& convolution = capturedConvolutions[input];
+        if (convolution == nullptr)
+            convolution = std::make_unique<juce::dsp::Convolution>(juce::dsp::Convolution::NonUniform { capturedHeadSize });
+
+        // This input's paths to the left and right outputs, as one stereo response
+        juce::AudioBuffer<float> paths(2, length);
+        for (int output = 0; output < 2; ++output)
+            paths.copyFrom(output, 0, impulseResponse, 2 * input + output, 0, length);
+
+        // Absolute level and leading delay are part of the effect, so no normalising or trimming
+        convolution->loadImpulseResponse(std::move(paths), impulseSampleRate,
+                                         juce::dsp::Convolution::Stereo::yes,
+                                         juce::dsp::Convolution::Trim::no,
+                                         juce::dsp::Convolution::Normalise::no);
+    }
+
+    // prepare picks up the queued responses, so they are active from the next block
+    prepareCapturedConvolutions();
+    captured.store(true);
+}
+
+void EffectProcessor::clearCapturedResponse()
+{
+    captured.store(false);
+    setModulationEnabled(true);
+    resetEffect();
+    parametersChanged.store(true);
+}
+
+void EffectProcessor::prepareCapturedConvolutions()
+{
+    for (int input = 0; input < 2; ++input)
+    {
+        capturedConvolutions[input]->prepare(currentSpec);
+        capturedPaths[input].setSize(2, static_cast<int>(currentSpec.maximumBlockSize));
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Describes one user parameter; the main window builds its controls from these
+struct EffectParameter
+{
+    EffectParameter(const juce::String& parameterName, float minimum, float maximum, float defaultVal,
+                    float step = 0.01f, const juce::StringArray& choiceNames = {})
+        : name(parameterName), minValue(minimum), maxValue(maximum), defaultValue(defaultVal),
+          interval(step), choices(choiceNames)
+    {
+    }
+
+    juce::String name;
+    float minValue;
+    float maxValue;
+    float defaultValue;
+    float interval;
+    juce::StringArray choices; // Non-empty: shown as a combo box, the value is the choice index
+};
+
+// Common interface of every selectable effect.
+// Parameters are written from the message thread and applied on the audio thread at the next block.
+class EffectProcessor
+{
+public:
+    EffectProcessor(const juce::String& effectName, std::vector<EffectParameter> effectParameters);
+    virtual ~EffectProcessor() = default;
+
+    const juce::String& getName() const { return name; }
+    const std::vector<EffectParameter>& getParameters() const { return parameters; }
+
+    // Parameter access (safe to call from the message thread)
+    void setParameter(int index, float value);
+    float getParameter(int index) const;
+
+    // Stereo spec; allocates, then applies the current parameter values
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    // Processes two channels in place, never longer than spec.maximumBlockSize
+    void process(const juce::dsp::AudioBlock<float>& block);
+
+    virtual void releaseResources() {}
+    virtual int getLatencySamples() const { return 0; }
+
+    // Effects that load data from disk (e.g. impulse responses) return a wildcard such as "*.wav".
+    // loadFile is called on the message thread and must leave heavy work to a background thread.
+    virtual juce::String getFileWildcard() const { return {}; }
+    virtual bool loadFile(const juce::File& file) { juce::ignoreUnused(file); return false; }
+    virtual juce::String getLoadedFileName() const { return {}; }
+
+    // Engine signals an effect can take as its sidechain (detector) input
+    enum SidechainSource
+    {
+        noSidechain = 0,
+        signalGeneratorSidechain,
+        deviceInputSidechain
+    };
+
+    // The engine routes this source to setSidechain before each process() call
+    virtual SidechainSource getSidechainSource() const { return noSidechain; }
+
+    // Audio thread only: stereo sidechain for the next process() call, the same length as its block.
+    // An empty block detaches it.
+    void setSidechain(const juce::dsp::AudioBlock<const float>& block) { sidechain = block; }
+
+    // Linear, time-invariant effects can be replaced by a convolution with their captured impulse response.
+    // It is true stereo: four channels, channel 2 * input + output for each path (left = 0, right = 1).
+    // setCapturedResponse, clearCapturedResponse and setModulationEnabled must not overlap process():
+    // call them holding the audio callback lock, or while the engine keeps the effect out of the
+    // audio callback altogether, as it does for the whole of a capture.
+    virtual bool isCapturable() const { return false; }
+    void setCapturedResponse(juce::AudioBuffer<float>&& impulseResponse, double impulseSampleRate);
+    void clearCapturedResponse();
+    bool isCaptured() const { return captured.load(); }
+
+    // Capturable effects with modulation hold it still while a response is rendered, so the capture
+    // is time-invariant; clearCapturedResponse lets it run again
+    virtual void setModulationEnabled(bool shouldModulate) { juce::ignoreUnused(shouldModulate); }
+
+    // Runs the effect's own algorithm even while a captured response is active (used to render the capture)
+    void processAlgorithm(const juce::dsp::AudioBlock<float>& block);
+
+protected:
+    virtual void prepareEffect(const juce::dsp::ProcessSpec& spec) = 0;
+    virtual void resetEffect() = 0;
+    virtual void processEffect(const juce::dsp::AudioBlock<float>& block) = 0;
+
+    // Called on the audio thread when a parameter changed; read values with getParameter
+    virtual void updateParameters() = 0;
+
+    // Empty unless the engine routed a sidechain to this block
+    const juce::dsp::AudioBlock<const float>& getSidechain() const { return sidechain; }
+
+private:
+    juce::String name;
+    std::vector<EffectParameter> parameters;
+    std::unique_ptr<std::atomic<float>[]> values;
+    std::atomic<bool> parametersChanged { true };
+    juce::dsp::AudioBlock<const float> sidechain;
+
+    // Captured response, created on the first capture and prepared with the last spec: one stereo
+    // convolution per input, each fed that input on both channels, and their outputs summed
+    static constexpr int capturedHeadSize = 1024;
+    juce::dsp::ProcessSpec currentSpec { 44100.0, 512, 2 };
+    std::unique_ptr<juce::dsp::Convolution> capturedConvolutions[2];
+    juce::AudioBuffer<float> capturedPaths[2];
+    std::atomic<bool> captured { false };
+
+    void prepareCapturedConvolutions();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EffectProcessor)
+};
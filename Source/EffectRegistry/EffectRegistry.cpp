@@ -0,0 +1,64 @@
+#include "EffectRegistry.h"
+#include "EmbeddedEffects.h"
+#include "JUCEEffects.h"
+#include "NoiseSuppressionEffect.h"
+
+EffectRegistry::EffectRegistry(float maxDelaySeconds)
+{
+    // Embedded effects
+    effects.push_back(std::make_unique<EmbeddedDelayEffect>(maxDelaySeconds));
+    effects.push_back(std::make_unique<EmbeddedFlangerEffect>());
+    effects.push_back(std::make_unique<EmbeddedPlateReverbEffect>());
+    effects.push_back(std::make_unique<EmbeddedPitchShiftEffect>());
+    effects.push_back(std::make_unique<EmbeddedCathedralReverbEffect>());
+
+    // JUCE DSP effects
+    effects.push_back(std::make_unique<JUCEDelayEffect>(maxDelaySeconds));
+    effects.push_back(std::make_unique<JUCEChorusEffect>("JUCE Flanger", 10.0f, 0.25f));
+    effects.push_back(std::make_unique<JUCEPitchShiftEffect>());
+    effects.push_back(std::make_unique<JUCEPlateReverbEffect>());
+    effects.push_back(std::make_unique<JUCEChorusEffect>("JUCE Chorus", 50.0f, 0.25f));
+    effects.push_back(std::make_unique<JUCEReverbEffect>());
+    effects.push_back(std::make_unique<JUCEPhaserEffect>());
+    effects.push_back(std::make_unique<JUCECompressorEffect>());
+    effects.push_back(std::make_unique<JUCEDistortionEffect>());
+    effects.push_back(std::make_unique<JUCEConvolutionReverbEffect>());
+
+    // External effects
+    effects.push_back(std::make_unique<NoiseSuppressionEffect>());
+}
+
+EffectProcessor* EffectRegistry::getEffect(int index) const
+{
+    if (!juce::isPositiveAndBelow(index, getNumEffects()))
+        return nullptr;
+
+    return effects[static_cast<size_t>(index)].get();
+}
+
+int EffectRegistry::indexOf(const juce::String& name) const
+{
+    for (int i = 0; i < getNumEffects(); ++i)
+        if (effects[static_cast<size_t>(i)]->getName() == name)
+            return i;
+
+    return -1;
+}
+
+void EffectRegistry::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    for (auto& effect : effects)
+        effect->prepare(spec);
+}
+
+void EffectRegistry::reset()
+{
+    for (auto& effect : effects)
+        effect->reset();
+}
+
+void EffectRegistry::releaseResources()
+{
+    for (auto& effect : effects)
+        effect->releaseResources();
+}
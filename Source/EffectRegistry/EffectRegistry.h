@@ -0,0 +1,25 @@
+#pragma once
+#include "EffectProcessor.h"
+
+// Owns one instance of every selectable effect. The index of an effect is its position in the
+// effect selector; adding an effect means adding one line to the constructor.
+class EffectRegistry
+{
+public:
+    explicit EffectRegistry(float maxDelaySeconds);
+    ~EffectRegistry() = default;
+
+    int getNumEffects() const { return static_cast<int>(effects.size()); }
+    EffectProcessor* getEffect(int index) const;
+    int indexOf(const juce::String& name) const;
+
+    // Applied to every registered effect
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+    void releaseResources();
+
+private:
+    std::vector<std::unique_ptr<EffectProcessor>> effects;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EffectRegistry)
+};
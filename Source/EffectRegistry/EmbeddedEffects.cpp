@@ -0,0 +1,175 @@
+#include "EmbeddedEffects.h"
+
+//==============================================================================
+// Delay
+
+EmbeddedDelayEffect::EmbeddedDelayEffect(float maxDelaySeconds)
+    : EffectProcessor("Delay", { { "Delay", 0.0f, maxDelaySeconds, 0.5f },
+                                 { "Feedback", 0.0f, 0.95f, 0.5f } })
+{
+    FxDelayInit(getParameter(1), getParameter(0));
+}
+
+void EmbeddedDelayEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    juce::ignoreUnused(spec); // Fixed-rate module
+}
+
+void EmbeddedDelayEffect::resetEffect()
+{
+    FxDelayInit(getParameter(1), getParameter(0));
+}
+
+void EmbeddedDelayEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    auto* left = block.getChannelPointer(0);
+    auto* right = block.getChannelPointer(1);
+
+    for (size_t i = 0; i < block.getNumSamples(); ++i)
+        FxDelayProcess(left[i], right[i], &left[i], &right[i]);
+}
+
+void EmbeddedDelayEffect::updateParameters()
+{
+    FxDelayParaUpdate(getParameter(1), getParameter(0));
+}
+
+//==============================================================================
+// Cathedral reverb
+
+EmbeddedCathedralReverbEffect::EmbeddedCathedralReverbEffect()
+    : EffectProcessor("Cathedral Reverb", { { "Decay", 0.0f, 1.0f, 0.5f },
+                                            { "Tone", 0.0f, 1.0f, 0.5f } })
+{
+    FxCathedralRevbInit(getParameter(0), getParameter(1));
+}
+
+void EmbeddedCathedralReverbEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    juce::ignoreUnused(spec); // Fixed-rate module
+}
+
+void EmbeddedCathedralReverbEffect::resetEffect()
+{
+    FxCathedralRevbInit(getParameter(0), getParameter(1));
+}
+
+void EmbeddedCathedralReverbEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    auto* left = block.getChannelPointer(0);
+    auto* right = block.getChannelPointer(1);
+
+    for (size_t i = 0; i < block.getNumSamples(); ++i)
+        FxCathedralRevbProcess(left[i], right[i], &left[i], &right[i]);
+}
+
+void EmbeddedCathedralReverbEffect::updateParameters()
+{
+    FxCathedralRevbParaUpdate(getParameter(0), getParameter(1));
+}
+
+void EmbeddedCathedralReverbEffect::setModulationEnabled(bool shouldModulate)
+{
+    FxCathedralRevbSetModulation(shouldModulate ? 1u : 0u);
+}
+
+//==============================================================================
+// Flanger
+
+EmbeddedFlangerEffect::EmbeddedFlangerEffect()
+    : EffectProcessor("Flanger", { { "Rate", 0.0f, 1.0f, 0.5f },
+                                   { "Depth", 0.0f, 1.0f, 0.5f } })
+{
+    FxFlangerInit(&state, getParameter(0), getParameter(1));
+}
+
+void EmbeddedFlangerEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    FxFlangerSetSampleRate(&state, static_cast<float>(spec.sampleRate));
+}
+
+void EmbeddedFlangerEffect::resetEffect()
+{
+    FxFlangerClearMemory(&state);
+}
+
+void EmbeddedFlangerEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    auto* left = block.getChannelPointer(0);
+    auto* right = block.getChannelPointer(1);
+    FxFlangerProcessBlock(&state, left, right, left, right, static_cast<uint32_t>(block.getNumSamples()));
+}
+
+void EmbeddedFlangerEffect::updateParameters()
+{
+    FxFlangerParaUpdate(&state, getParameter(0), getParameter(1));
+}
+
+//==============================================================================
+// Plate reverb
+
+EmbeddedPlateReverbEffect::EmbeddedPlateReverbEffect()
+    : EffectProcessor("Plate Reverb", { { "Decay", 0.0f, 1.0f, 0.5f },
+                                        { "Tone", 0.0f, 1.0f, 0.5f } })
+{
+    FxPlateRevbInit(&state, getParameter(0), getParameter(1));
+}
+
+void EmbeddedPlateReverbEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    FxPlateRevbSetSampleRate(&state, static_cast<float>(spec.sampleRate));
+}
+
+void EmbeddedPlateReverbEffect::resetEffect()
+{
+    FxPlateRevbClearMemory(&state);
+}
+
+void EmbeddedPlateReverbEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    auto* left = block.getChannelPointer(0);
+    auto* right = block.getChannelPointer(1);
+    FxPlateRevbProcessBlock(&state, left, right, left, right, static_cast<uint32_t>(block.getNumSamples()));
+}
+
+void EmbeddedPlateReverbEffect::updateParameters()
+{
+    FxPlateRevbParaUpdate(&state, getParameter(0), getParameter(1));
+}
+
+void EmbeddedPlateReverbEffect::setModulationEnabled(bool shouldModulate)
+{
+    FxPlateRevbSetModulation(&state, shouldModulate ? 1u : 0u);
+}
+
+//==============================================================================
+// Pitch shift
+
+EmbeddedPitchShiftEffect::EmbeddedPitchShiftEffect()
+    : EffectProcessor("Pitch Shift", { { "Semitone", 0.0f, 1.0f, 0.5f },
+                                       { "Detune", 0.0f, 1.0f, 0.5f } })
+{
+    FxPitchInit(&state, getParameter(0), getParameter(1));
+}
+
+void EmbeddedPitchShiftEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    FxPitchSetSampleRate(&state, static_cast<float>(spec.sampleRate));
+}
+
+void EmbeddedPitchShiftEffect::resetEffect()
+{
+    FxPitchClearMemory(&state);
+}
+
+void EmbeddedPitchShiftEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    auto* left = block.getChannelPointer(0);
+    auto* right = block.getChannelPointer(1);
+    FxPitchProcessBlock(&state, left, right, left, right, static_cast<uint32_t>(block.getNumSamples()));
+}
+
+void EmbeddedPitchShiftEffect::updateParameters()
+{
+    FxPitchParaUpdate(&state, getParameter(0), getParameter(1));
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "EffectProcessor.h"
+#include "../EffectEmbeded/effect_delay.h"
+#include "../EffectEmbeded/effect_cathedral_reverb.h"
+#include "../EffectEmbeded/effect_flanger.h"
+#include "../EffectEmbeded/effect_plate_reverb.h"
+#include "../EffectEmbeded/effect_pitch.h"
+
+// Adapters for the C effects in EffectEmbeded.
+// Delay and cathedral reverb keep their state in module globals, so only one instance of each may exist.
+
+class EmbeddedDelayEffect : public EffectProcessor
+{
+public:
+    explicit EmbeddedDelayEffect(float maxDelaySeconds);
+
+    bool isCapturable() const override { return true; }
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+};
+
+class EmbeddedCathedralReverbEffect : public EffectProcessor
+{
+public:
+    EmbeddedCathedralReverbEffect();
+
+    // The comb LFO is held while capturing, so the response is time-invariant
+    bool isCapturable() const override { return true; }
+    void setModulationEnabled(bool shouldModulate) override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+};
+
+class EmbeddedFlangerEffect : public EffectProcessor
+{
+public:
+    EmbeddedFlangerEffect();
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    FxFlangerState state;
+};
+
+class EmbeddedPlateReverbEffect : public EffectProcessor
+{
+public:
+    EmbeddedPlateReverbEffect();
+
+    // The tank modulation is held while capturing, so the response is time-invariant
+    bool isCapturable() const override { return true; }
+    void setModulationEnabled(bool shouldModulate) override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    FxPlateRevbState state;
+};
+
+class EmbeddedPitchShiftEffect : public EffectProcessor
+{
+public:
+    EmbeddedPitchShiftEffect();
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    FxPitchState state;
+};
@@ -0,0 +1,399 @@
+#include "JUCEEffects.h"
+
+namespace
+{
+    // Replace NaN/Inf so a bad sample cannot poison recursive effect state
+    void sanitizeBlock(const juce::dsp::AudioBlock<float>& block)
+    {
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+        {
+            auto* data = block.getChannelPointer(channel);
+            for (size_t i = 0; i < block.getNumSamples(); ++i)
+                if (!std::isfinite(data[i])) data[i] = 0.0f;
+        }
+    }
+
+    template <typename ProcessorType>
+    void processReplacing(ProcessorType& processor, const juce::dsp::AudioBlock<float>& block)
+    {
+        sanitizeBlock(block);
+        juce::dsp::AudioBlock<float> replacing(block);
+        juce::dsp::ProcessContextReplacing<float> context(replacing);
+        processor.process(context);
+        sanitizeBlock(block);
+    }
+
+    // Non-owning AudioBuffer over a stereo block, for processors with a buffer API
+    template <typename Function>
+    void withStereoBuffer(const juce::dsp::AudioBlock<float>& block, Function&& function)
+    {
+        float* channels[2] = { block.getChannelPointer(0), block.getChannelPointer(1) };
+        juce::AudioBuffer<float> view(channels, 2, static_cast<int>(block.getNumSamples()));
+        function(view, static_cast<int>(block.getNumSamples()));
+    }
+}
+
+//==============================================================================
+// Delay
+
+JUCEDelayEffect::JUCEDelayEffect(float maxDelaySeconds)
+    : EffectProcessor("JUCE Delay", { { "Delay Time", 0.0f, maxDelaySeconds * 1000.0f, 500.0f },
+                                      { "Feedback", 0.0f, 0.95f, 0.3f },
+                                      { "Mix", 0.0f, 1.0f, 0.5f } }),
+      maxDelayMs(maxDelaySeconds * 1000.0f)
+{
+}
+
+void JUCEDelayEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    delay.prepare(spec.sampleRate, static_cast<int>(spec.maximumBlockSize), maxDelayMs);
+}
+
+void JUCEDelayEffect::resetEffect()
+{
+    delay.reset();
+}
+
+void JUCEDelayEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    withStereoBuffer(block, [this](juce::AudioBuffer<float>& buffer, int numSamples) { delay.process(buffer, numSamples); });
+}
+
+void JUCEDelayEffect::updateParameters()
+{
+    // Smoothed inside the processor, no reallocation on time changes
+    delay.setDelayTime(getParameter(0));
+    delay.setFeedback(getParameter(1));
+    delay.setMix(getParameter(2));
+}
+
+//==============================================================================
+// Chorus / flanger
+
+JUCEChorusEffect::JUCEChorusEffect(const juce::String& effectName, float maxCentreDelayMs, float defaultDepth)
+    : EffectProcessor(effectName, { { "Rate", 0.1f, 10.0f, 1.0f },
+                                    { "Depth", 0.0f, 1.0f, defaultDepth },
+                                    { "Centre Delay", 1.0f, maxCentreDelayMs, 7.0f },
+                                    { "Feedback", 0.0f, 0.95f, 0.0f },
+                                    { "Mix", 0.0f, 1.0f, 0.5f } })
+{
+}
+
+void JUCEChorusEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    chorus.prepare(spec);
+}
+
+void JUCEChorusEffect::resetEffect()
+{
+    chorus.reset();
+}
+
+void JUCEChorusEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    processReplacing(chorus, block);
+}
+
+void JUCEChorusEffect::updateParameters()
+{
+    chorus.setRate(getParameter(0));
+    chorus.setDepth(getParameter(1));
+    chorus.setCentreDelay(getParameter(2));
+    chorus.setFeedback(getParameter(3));
+    chorus.setMix(getParameter(4));
+}
+
+//==============================================================================
+// Reverb
+
+JUCEReverbEffect::JUCEReverbEffect()
+    : EffectProcessor("JUCE Reverb", { { "Room Size", 0.0f, 1.0f, 0.5f },
+                                       { "Damping", 0.0f, 1.0f, 0.5f },
+                                       { "Wet Level", 0.0f, 1.0f, 0.33f },
+                                       { "Dry Level", 0.0f, 1.0f, 0.4f },
+                                       { "Width", 0.0f, 1.0f, 1.0f } })
+{
+}
+
+void JUCEReverbEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    reverb.prepare(spec);
+}
+
+void JUCEReverbEffect::resetEffect()
+{
+    reverb.reset();
+}
+
+void JUCEReverbEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    processReplacing(reverb, block);
+}
+
+void JUCEReverbEffect::updateParameters()
+{
+    juce::Reverb::Parameters params;
+    params.roomSize = getParameter(0);
+    params.damping = getParameter(1);
+    params.wetLevel = getParameter(2);
+    params.dryLevel = getParameter(3);
+    params.width = getParameter(4);
+    params.freezeMode = 0.0f;
+
+    reverb.setParameters(params);
+}
+
+//==============================================================================
+// Plate reverb
+
+JUCEPlateReverbEffect::JUCEPlateReverbEffect()
+    : EffectProcessor("JUCE Plate Reverb", { { "Room Size", 0.0f, 1.0f, 0.5f },
+                                             { "Damping", 0.0f, 1.0f, 0.5f },
+                                             { "Wet Level", 0.0f, 1.0f, 0.33f } })
+{
+}
+
+void JUCEPlateReverbEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    reverb.prepare(spec);
+}
+
+void JUCEPlateReverbEffect::resetEffect()
+{
+    reverb.reset();
+}
+
+void JUCEPlateReverbEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    processReplacing(reverb, block);
+}
+
+void JUCEPlateReverbEffect::updateParameters()
+{
+    juce::Reverb::Parameters params;
+    params.roomSize = getParameter(0);
+    params.damping = getParameter(1);
+    params.wetLevel = getParameter(2);
+    params.dryLevel = 1.0f - params.wetLevel; // Complement of wet level
+    params.width = 1.0f;
+    params.freezeMode = 0.0f;
+
+    reverb.setParameters(params);
+}
+
+//==============================================================================
+// Phaser
+
+JUCEPhaserEffect::JUCEPhaserEffect()
+    : EffectProcessor("JUCE Phaser", { { "Rate", 0.1f, 10.0f, 1.0f },
+                                       { "Depth", 0.0f, 1.0f, 1.0f },
+                                       { "Centre Freq", 200.0f, 2000.0f, 1300.0f },
+                                       { "Feedback", 0.0f, 0.95f, 0.0f },
+                                       { "Mix", 0.0f, 1.0f, 0.5f } })
+{
+}
+
+void JUCEPhaserEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    phaser.prepare(spec);
+}
+
+void JUCEPhaserEffect::resetEffect()
+{
+    phaser.reset();
+}
+
+void JUCEPhaserEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    processReplacing(phaser, block);
+}
+
+void JUCEPhaserEffect::updateParameters()
+{
+    phaser.setRate(getParameter(0));
+    phaser.setDepth(getParameter(1));
+    phaser.setCentreFrequency(getParameter(2));
+    phaser.setFeedback(getParameter(3));
+    phaser.setMix(getParameter(4));
+}
+
+//==============================================================================
+// Compressor
+
+JUCECompressorEffect::JUCECompressorEffect()
+    : EffectProcessor("JUCE Compressor", { { "Threshold", -60.0f, 0.0f, -10.0f },
+                                           { "Ratio", 1.0f, 20.0f, 4.0f },
+                                           { "Attack", 0.1f, 100.0f, 2.0f },
+                                           { "Release", 1.0f, 1000.0f, 100.0f },
+                                           { "Lookahead", 0.0f, 20.0f, 0.0f, 0.1f },
+                                           { "Sidechain", 0.0f, 2.0f, 0.0f, 1.0f, { "Off", "Signal Generator", "Device Input" } } })
+{
+}
+
+int JUCECompressorEffect::getLatencySamples() const
+{
+    return compressor.getLatencySamples(getParameter(4));
+}
+
+EffectProcessor::SidechainSource JUCECompressorEffect::getSidechainSource() const
+{
+    return static_cast<SidechainSource>(juce::roundToInt(getParameter(5)));
+}
+
+void JUCECompressorEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    compressor.prepare(spec.sampleRate, static_cast<int>(spec.maximumBlockSize));
+}
+
+void JUCECompressorEffect::resetEffect()
+{
+    compressor.reset();
+}
+
+void JUCECompressorEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    sanitizeBlock(block);
+    withStereoBuffer(block, [this](juce::AudioBuffer<float>& buffer, int numSamples) { compressor.process(buffer, numSamples, getSidechain()); });
+}
+
+void JUCECompressorEffect::updateParameters()
+{
+    // Picked up by the processor at the next block boundary
+    compressor.setThreshold(getParameter(0));
+    compressor.setRatio(getParameter(1));
+    compressor.setAttack(getParameter(2));
+    compressor.setRelease(getParameter(3));
+    compressor.setLookahead(getParameter(4));
+}
+
+//==============================================================================
+// Distortion
+
+JUCEDistortionEffect::JUCEDistortionEffect()
+    : EffectProcessor("JUCE Distortion", { { "Drive", 0.0f, 1.0f, 0.5f },
+                                           { "Range", 0.0f, 1.0f, 0.5f },
+                                           { "Blend", 0.0f, 1.0f, 0.5f },
+                                           { "Curve", 0.0f, 2.0f, 0.0f, 1.0f, { "Tanh", "Soft Clip", "Tube" } },
+                                           { "Oversampling", 0.0f, 3.0f, 0.0f, 1.0f, { "Off", "2x", "4x", "8x" } },
+                                           { "Filter", 0.0f, 1.0f, 0.0f, 1.0f, { "IIR", "FIR" } } })
+{
+}
+
+int JUCEDistortionEffect::getLatencySamples() const
+{
+    return distortion.getLatencySamples(juce::roundToInt(getParameter(4)),
+                                        getParameter(5) >= 0.5f ? DistortionProcessor::HalfBandFIR : DistortionProcessor::PolyphaseIIR);
+}
+
+void JUCEDistortionEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    distortion.prepare(spec.sampleRate, static_cast<int>(spec.maximumBlockSize));
+}
+
+void JUCEDistortionEffect::resetEffect()
+{
+    distortion.reset();
+}
+
+void JUCEDistortionEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    sanitizeBlock(block);
+    withStereoBuffer(block, [this](juce::AudioBuffer<float>& buffer, int numSamples) { distortion.process(buffer, numSamples); });
+}
+
+void JUCEDistortionEffect::updateParameters()
+{
+    // Smoothed inside the processor
+    distortion.setDrive(1.0f + getParameter(0) * 10.0f);
+    distortion.setRange(getParameter(1));
+    distortion.setBlend(getParameter(2));
+    distortion.setCurve(static_cast<DistortionProcessor::Curve>(juce::roundToInt(getParameter(3))));
+    distortion.setOversampling(juce::roundToInt(getParameter(4)),
+                               getParameter(5) >= 0.5f ? DistortionProcessor::HalfBandFIR : DistortionProcessor::PolyphaseIIR);
+}
+
+//==============================================================================
+// Pitch shift
+
+JUCEPitchShiftEffect::JUCEPitchShiftEffect()
+    : EffectProcessor("JUCE Pitch Shift", { { "Semitones", -12.0f, 12.0f, 0.0f },
+                                            { "Mode", 0.0f, 1.0f, 0.0f, 1.0f, { "Phase Vocoder", "WSOLA" } } })
+{
+}
+
+int JUCEPitchShiftEffect::getLatencySamples() const
+{
+    return pitchShifter.getLatencySamples(getParameter(1) >= 0.5f ? PitchShiftProcessor::WSOLA
+                                                                  : PitchShiftProcessor::PhaseVocoder);
+}
+
+void JUCEPitchShiftEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    pitchShifter.prepare(spec.sampleRate, static_cast<int>(spec.maximumBlockSize));
+}
+
+void JUCEPitchShiftEffect::resetEffect()
+{
+    pitchShifter.reset();
+}
+
+void JUCEPitchShiftEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    withStereoBuffer(block, [this](juce::AudioBuffer<float>& buffer, int numSamples) { pitchShifter.process(buffer, numSamples); });
+}
+
+void JUCEPitchShiftEffect::updateParameters()
+{
+    // Picked up by the processor at the next block boundary
+    pitchShifter.setSemitones(getParameter(0));
+    pitchShifter.setMode(getParameter(1) >= 0.5f ? PitchShiftProcessor::WSOLA : PitchShiftProcessor::PhaseVocoder);
+}
+
+//==============================================================================
+// Convolution reverb
+
+JUCEConvolutionReverbEffect::JUCEConvolutionReverbEffect()
+    : EffectProcessor("JUCE Convolution Reverb", { { "Mix", 0.0f, 1.0f, 0.3f },
+                                                   { "Wet Gain", -24.0f, 24.0f, 6.0f, 0.1f } })
+{
+}
+
+int JUCEConvolutionReverbEffect::getLatencySamples() const
+{
+    return convolutionReverb.getLatencySamples();
+}
+
+bool JUCEConvolutionReverbEffect::loadFile(const juce::File& file)
+{
+    if (!convolutionReverb.loadImpulseResponse(file))
+        return false;
+
+    impulseResponseFile = file;
+    return true;
+}
+
+juce::String JUCEConvolutionReverbEffect::getLoadedFileName() const
+{
+    return impulseResponseFile.getFileName();
+}
+
+void JUCEConvolutionReverbEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    convolutionReverb.prepare(spec);
+}
+
+void JUCEConvolutionReverbEffect::resetEffect()
+{
+    convolutionReverb.reset();
+}
+
+void JUCEConvolutionReverbEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    withStereoBuffer(block, [this](juce::AudioBuffer<float>& buffer, int numSamples) { convolutionReverb.process(buffer, numSamples); });
+}
+
+void JUCEConvolutionReverbEffect::updateParameters()
+{
+    convolutionReverb.setMix(getParameter(0));
+    convolutionReverb.setWetGain(getParameter(1));
+}
@@ -0,0 +1,167 @@
+#pragma once
+#include "EffectProcessor.h"
+#include "../EffectJUCE/StereoDelayProcessor.h"
+#include "../EffectJUCE/PitchShiftProcessor.h"
+#include "../EffectJUCE/ConvolutionReverbProcessor.h"
+#include "../EffectJUCE/DistortionProcessor.h"
+#include "../EffectJUCE/CompressorProcessor.h"
+
+// Adapters for juce::dsp processors and the block processors in EffectJUCE
+
+class JUCEDelayEffect : public EffectProcessor
+{
+public:
+    explicit JUCEDelayEffect(float maxDelaySeconds);
+
+    bool isCapturable() const override { return true; }
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    StereoDelayProcessor delay;
+    float maxDelayMs;
+};
+
+// Chorus and flanger share juce::dsp::Chorus with different ranges
+class JUCEChorusEffect : public EffectProcessor
+{
+public:
+    JUCEChorusEffect(const juce::String& effectName, float maxCentreDelayMs, float defaultDepth);
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    juce::dsp::Chorus<float> chorus;
+};
+
+class JUCEReverbEffect : public EffectProcessor
+{
+public:
+    JUCEReverbEffect();
+
+    bool isCapturable() const override { return true; }
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    juce::dsp::Reverb reverb;
+};
+
+// Full-width reverb with the dry level tied to the wet level
+class JUCEPlateReverbEffect : public EffectProcessor
+{
+public:
+    JUCEPlateReverbEffect();
+
+    bool isCapturable() const override { return true; }
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    juce::dsp::Reverb reverb;
+};
+
+class JUCEPhaserEffect : public EffectProcessor
+{
+public:
+    JUCEPhaserEffect();
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    juce::dsp::Phaser<float> phaser;
+};
+
+class JUCECompressorEffect : public EffectProcessor
+{
+public:
+    JUCECompressorEffect();
+
+    int getLatencySamples() const override;
+    SidechainSource getSidechainSource() const override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    CompressorProcessor compressor;
+};
+
+class JUCEDistortionEffect : public EffectProcessor
+{
+public:
+    JUCEDistortionEffect();
+
+    int getLatencySamples() const override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    DistortionProcessor distortion;
+};
+
+class JUCEPitchShiftEffect : public EffectProcessor
+{
+public:
+    JUCEPitchShiftEffect();
+
+    int getLatencySamples() const override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    PitchShiftProcessor pitchShifter;
+};
+
+// Convolution with an impulse response loaded from a WAV/AIFF file
+class JUCEConvolutionReverbEffect : public EffectProcessor
+{
+public:
+    JUCEConvolutionReverbEffect();
+
+    int getLatencySamples() const override;
+    juce::String getFileWildcard() const override { return "*.wav;*.aif;*.aiff"; }
+    bool loadFile(const juce::File& file) override;
+    juce::String getLoadedFileName() const override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    ConvolutionReverbProcessor convolutionReverb;
+    juce::File impulseResponseFile; // Message thread only
+};
@@ -0,0 +1,41 @@
+#include "NoiseSuppressionEffect.h"
+
+NoiseSuppressionEffect::NoiseSuppressionEffect()
+    : EffectProcessor("Noise Suppression", { { "VAD Threshold", 0.0f, 1.0f, 0.6f },
+                                             { "VAD Grace Period (ms)", 0.0f, 500.0f, 20.0f, 1.0f },
+                                             { "VAD Retroactive Grace (ms)", 0.0f, 10.0f, 0.0f, 1.0f } })
+{
+}
+
+void NoiseSuppressionEffect::releaseResources()
+{
+    processor.releaseResources();
+}
+
+void NoiseSuppressionEffect::prepareEffect(const juce::dsp::ProcessSpec& spec)
+{
+    currentSampleRate = spec.sampleRate;
+    processor.prepareToPlay(spec.sampleRate, 2); // stereo
+}
+
+void NoiseSuppressionEffect::resetEffect()
+{
+    // RNNoise has no reset entry point; recreate its state
+    processor.releaseResources();
+    processor.prepareToPlay(currentSampleRate, 2);
+}
+
+void NoiseSuppressionEffect::processEffect(const juce::dsp::AudioBlock<float>& block)
+{
+    // Non-owning view trimmed to this block's length
+    float* channels[2] = { block.getChannelPointer(0), block.getChannelPointer(1) };
+    juce::AudioBuffer<float> view(channels, 2, static_cast<int>(block.getNumSamples()));
+    processor.processBlock(view);
+}
+
+void NoiseSuppressionEffect::updateParameters()
+{
+    processor.setVadThreshold(getParameter(0));
+    processor.setVadGracePeriod(juce::roundToInt(getParameter(1)));
+    processor.setVadRetroactiveGracePeriod(juce::roundToInt(getParameter(2)));
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "EffectProcessor.h"
+#include "../EffectExternal/NoiseSuppressionProcessor.h"
+
+// Adapter for the RNNoise based noise suppression in EffectExternal
+class NoiseSuppressionEffect : public EffectProcessor
+{
+public:
+    NoiseSuppressionEffect();
+
+    void releaseResources() override;
+
+protected:
+    void prepareEffect(const juce::dsp::ProcessSpec& spec) override;
+    void resetEffect() override;
+    void processEffect(const juce::dsp::AudioBlock<float>& block) override;
+    void updateParameters() override;
+
+private:
+    NoiseSuppressionProcessor processor;
+    double currentSampleRate = 48000.0;
+};
@@ -11,8 +11,23 @@ public:
     const juce::String getApplicationVersion() override { return "1.0.0"; }
     bool moreThanOneInstanceAllowed() override { return true; }
 
-    void initialise(const juce::String& /*commandLine*/) override
+    void initialise(const juce::String& commandLine) override
     {
+        // Runs the juce::UnitTest suites compiled into the app instead of opening the window
+        if (commandLine.contains("--run-tests"))
+        {
+            juce::UnitTestRunner runner;
+            runner.runAllTests();
+
+            int failures = 0;
+            for (int i = 0; i < runner.getNumResults(); ++i)
+                failures += runner.getResult(i)->failures;
+
+            setApplicationReturnValue(failures > 0 ? 1 : 0);
+            quit();
+            return;
+        }
+
         mainWindow.reset(new MainWindow(getApplicationName(), new MainComponent()));
     }
 
@@ -1,4 +1,5 @@
 #include "MainComponent.h"
+#include "EffectJUCE/ChannelDispatch.h"
 #include <JuceHeader.h> 
 #include <cmath>
 #include <cstdint>
@@ -35,10 +36,6 @@ MainComponent::MainComponent()
     // Create shared signal generator engine (for internal source)
     signalGenEngine = std::make_unique<SignalGenAudioEngine>();
 
-    // Configure delay and feedback sliders
-    configureSlider(delaySlider, delayLabel, "Delay", 0.0, maxDelayTime, 0.5);
-    configureSlider(feedbackSlider, feedbackLabel, "Feedback", 0.0, 0.95, 0.5);
-
     // Configure spectrum analyzer
     addAndMakeVisible(inputSpectrumAnalyzer);
     addAndMakeVisible(outputSpectrumAnalyzer);
@@ -91,19 +88,9 @@ MainComponent::MainComponent()
     updateDeviceLists();
     setSize(1600, 950);
 
-    // Configure effect selector with JUCE effects
-    effectSelector.addItem("Delay", 1);
-    effectSelector.addItem("Flanger", 2);
-    effectSelector.addItem("Plate Reverb", 3);
-    effectSelector.addItem("Pitch Shift", 4);
-    effectSelector.addItem("Cathedral Reverb", 5);
-    effectSelector.addItem("JUCE Delay", 6);
-    effectSelector.addItem("JUCE Chorus", 7);
-    effectSelector.addItem("JUCE Reverb", 8);
-    effectSelector.addItem("JUCE Phaser", 9);
-    effectSelector.addItem("JUCE Compressor", 10);
-    effectSelector.addItem("JUCE Distortion", 11);
-    effectSelector.addItem("Noise Suppression", 12);
+    // Configure effect selector from the effect registry
+    for (int i = 0; i < effectRegistry.getNumEffects(); ++i)
+        effectSelector.addItem(effectRegistry.getEffect(i)->getName(), i + 1);
     effectSelector.setSelectedId(1, juce::dontSendNotification);
     effectSelector.addListener(this);
     addAndMakeVisible(effectSelector);
@@ -117,105 +104,6 @@ MainComponent::MainComponent()
     effectEnableToggle.addListener(this);
     addAndMakeVisible(effectEnableToggle);
     
-    // Configure original effect parameter sliders
-    configureSlider(flangerRateSlider, flangerRateLabel, "Rate", 0.0, 1.0, 0.5);
-    configureSlider(flangerDepthSlider, flangerDepthLabel, "Depth", 0.0, 1.0, 0.5);
-    configureSlider(plateDecaySlider, plateDecayLabel, "Decay", 0.0, 1.0, 0.5);
-    configureSlider(plateToneSlider, plateToneLabel, "Tone", 0.0, 1.0, 0.5);
-    configureSlider(pitchSemitoneSlider, pitchSemitoneLabel, "Semitone", 0.0, 1.0, 0.5);
-    configureSlider(pitchDetuneSlider, pitchDetuneLabel, "Detune", 0.0, 1.0, 0.5);
-    
-    // Cathedral reverb controls
-    configureSlider(cathedralDecaySlider, cathedralDecayLabel, "Decay", 0.0, 1.0, 0.5);
-    configureSlider(cathedralToneSlider, cathedralToneLabel, "Tone", 0.0, 1.0, 0.5);
-    
-    // Configure JUCE effect parameter sliders
-    configureSlider(juceDelayTimeSlider, juceDelayTimeLabel, "Delay Time", 0.0, 2000.0, 500.0);
-    configureSlider(juceDelayFeedbackSlider, juceDelayFeedbackLabel, "Feedback", 0.0, 0.95, 0.3);
-    configureSlider(juceDelayMixSlider, juceDelayMixLabel, "Mix", 0.0, 1.0, 0.5);
-    
-    configureSlider(juceChorusRateSlider, juceChorusRateLabel, "Rate", 0.1, 10.0, 1.0);
-    configureSlider(juceChorusDepthSlider, juceChorusDepthLabel, "Depth", 0.0, 1.0, 0.25);
-    configureSlider(juceChorusCentreDelaySlider, juceChorusCentreDelayLabel, "Centre Delay", 1.0, 50.0, 7.0);
-    configureSlider(juceChorusFeedbackSlider, juceChorusFeedbackLabel, "Feedback", 0.0, 0.95, 0.0);
-    configureSlider(juceChorusMixSlider, juceChorusMixLabel, "Mix", 0.0, 1.0, 0.5);
-    
-    configureSlider(juceReverbRoomSizeSlider, juceReverbRoomSizeLabel, "Room Size", 0.0, 1.0, 0.5);
-    configureSlider(juceReverbDampingSlider, juceReverbDampingLabel, "Damping", 0.0, 1.0, 0.5);
-    configureSlider(juceReverbWetLevelSlider, juceReverbWetLevelLabel, "Wet Level", 0.0, 1.0, 0.33);
-    configureSlider(juceReverbDryLevelSlider, juceReverbDryLevelLabel, "Dry Level", 0.0, 1.0, 0.4);
-    configureSlider(juceReverbWidthSlider, juceReverbWidthLabel, "Width", 0.0, 1.0, 1.0);
-    
-    configureSlider(jucePhaserRateSlider, jucePhaserRateLabel, "Rate", 0.1, 10.0, 1.0);
-    configureSlider(jucePhaserDepthSlider, jucePhaserDepthLabel, "Depth", 0.0, 1.0, 1.0);
-    configureSlider(jucePhaserCentreFreqSlider, jucePhaserCentreFreqLabel, "Centre Freq", 200.0, 2000.0, 1300.0);
-    configureSlider(jucePhaserFeedbackSlider, jucePhaserFeedbackLabel, "Feedback", 0.0, 0.95, 0.0);
-    configureSlider(jucePhaserMixSlider, jucePhaserMixLabel, "Mix", 0.0, 1.0, 0.5);
-    
-    configureSlider(juceCompressorThresholdSlider, juceCompressorThresholdLabel, "Threshold", -60.0, 0.0, -10.0);
-    configureSlider(juceCompressorRatioSlider, juceCompressorRatioLabel, "Ratio", 1.0, 20.0, 4.0);
-    configureSlider(juceCompressorAttackSlider, juceCompressorAttackLabel, "Attack", 0.1, 100.0, 2.0);
-    configureSlider(juceCompressorReleaseSlider, juceCompressorReleaseLabel, "Release", 1.0, 1000.0, 100.0);
-
-    // Configure Noise Suppression parameter sliders
-    configureSlider(noiseSuppressionVadThresholdSlider, noiseSuppressionVadThresholdLabel, "VAD Threshold", 0.0, 1.0, 0.6);
-    configureSlider(noiseSuppressionVadGracePeriodSlider, noiseSuppressionVadGracePeriodLabel, "VAD Grace Period (ms)", 0, 500, 20);
-    configureSlider(noiseSuppressionVadRetroactiveGracePeriodSlider, noiseSuppressionVadRetroactiveGracePeriodLabel, "VAD Retroactive Grace (ms)", 0, 10, 0);
-
-    configureSlider(juceDistortionDriveSlider, juceDistortionDriveLabel, "Drive", 0.0, 1.0, 0.5);
-    configureSlider(juceDistortionRangeSlider, juceDistortionRangeLabel, "Range", 0.0, 1.0, 0.5);
-    configureSlider(juceDistortionBlendSlider, juceDistortionBlendLabel, "Blend", 0.0, 1.0, 0.5);
-    
-    // Initialize audio parameters
-    gain = 1.0f;
-    delayTime = 0.5f;
-    feedbackGain = 0.5f;
-    flangerRate = 0.5f;
-    flangerDepth = 0.5f;
-    plateDecay = 0.5f;
-    plateTone = 0.5f;
-    pitchSemitone = 0.5f;
-    pitchDetune = 0.5f;
-    
-    // Initialize JUCE effect parameters
-    juceDelayTime = 500.0f;
-    juceDelayFeedback = 0.3f;
-    juceDelayMix = 0.5f;
-    
-    juceChorusRate = 1.0f;
-    juceChorusDepth = 0.25f;
-    juceChorusCentreDelay = 7.0f;
-    juceChorusFeedback = 0.0f;
-    juceChorusMix = 0.5f;
-    
-    juceReverbRoomSize = 0.5f;
-    juceReverbDamping = 0.5f;
-    juceReverbWetLevel = 0.33f;
-    juceReverbDryLevel = 0.4f;
-    juceReverbWidth = 1.0f;
-    
-    jucePhaserRate = 1.0f;
-    jucePhaserDepth = 1.0f;
-    jucePhaserCentreFreq = 1300.0f;
-    jucePhaserFeedback = 0.0f;
-    jucePhaserMix = 0.5f;
-    
-    juceCompressorThreshold = -10.0f;
-    juceCompressorRatio = 4.0f;
-    juceCompressorAttack = 2.0f;
-    juceCompressorRelease = 100.0f;
-    
-    juceDistortionDrive = 0.5f;
-    juceDistortionRange = 0.5f;
-    juceDistortionBlend = 0.5f;
-    
-    // Initialize effect modules
-    FxDelayInit(feedbackGain, delayTime);
-    //FxFlangerInit(flangerRate, flangerDepth);
-    //FxPlateRevbInit(plateDecay, plateTone);
-    //FxPitchInit(pitchSemitone, pitchDetune);
-    FxCathedralRevbInit(cathedralDecay, cathedralTone);
-    
     // Initialize recorder
     audioRecorder = std::make_unique<AudioRecorder>();
     
@@ -223,7 +111,7 @@ MainComponent::MainComponent()
     eqProcessorL = std::make_unique<IIRFilterProcessor>();
     eqProcessorR = std::make_unique<IIRFilterProcessor>();
     limiterProcessor = std::make_unique<LimiterProcessor>();
-    updateEffectControls();
+    rebuildEffectControls();
 
      // Initialize sweep generator
     sweepGenerator = std::make_unique<SweepTestGenerator>();
@@ -300,43 +188,23 @@ void MainComponent::prepareToPlay(int samplesPerBlockExpected, double sampleRate
     inputWaveformAnalyzer.setSampleRate(sampleRate);
     outputWaveformAnalyzer.setSampleRate(sampleRate);
     
-    //FxFlangerSetSampleRate(sampleRate);
-
-    // Initialize JUCE DSP effects
+    // Initialize effects
     spec.sampleRate = sampleRate;
     spec.maximumBlockSize = samplesPerBlockExpected;
     spec.numChannels = 2;
     
-    juceDelay.prepare(spec);
-    juceChorus.prepare(spec);
-    juceReverb.prepare(spec);
-    jucePhaser.prepare(spec);
-    juceCompressor.prepare(spec);
-    juceDistortion.prepare(spec);
-    
-    updateJUCEDelayParameters();
-    updateJUCEChorusParameters();
-    updateJUCEReverbParameters();
-    updateJUCEPhaserParameters();
-    updateJUCECompressorParameters();
-    updateJUCEDistortionParameters();
+    waitForEffectCapture();
+    effectRegistry.prepare(spec);
     
-    // Initialize EQ processors with sample rate
+    // Initialize EQ processors with sample rate and linear-phase block buffers
     if (eqProcessorL)
-        eqProcessorL->setSampleRate(static_cast<float>(sampleRate));
+        eqProcessorL->prepare(sampleRate, samplesPerBlockExpected);
     if (eqProcessorR)
-        eqProcessorR->setSampleRate(static_cast<float>(sampleRate));
+        eqProcessorR->prepare(sampleRate, samplesPerBlockExpected);
 
-    // Initialize limiter processor with sample rate
+    // Initialize limiter processor with sample rate and oversampling buffers
     if (limiterProcessor)
-        limiterProcessor->setSampleRate(static_cast<float>(sampleRate));
-
-    // Initialize noise suppression processor
-    noiseSuppressionProcessor = std::make_unique<NoiseSuppressionProcessor>();
-    noiseSuppressionProcessor->prepareToPlay(sampleRate, 2); // stereo
-    noiseSuppressionProcessor->setVadThreshold(noiseSuppressionVadThreshold);
-    noiseSuppressionProcessor->setVadGracePeriod(noiseSuppressionVadGracePeriod);
-    noiseSuppressionProcessor->setVadRetroactiveGracePeriod(noiseSuppressionVadRetroactiveGracePeriod);
+        limiterProcessor->prepare(sampleRate, samplesPerBlockExpected);
 
     if (sweepGenerator)
     {
@@ -349,6 +217,11 @@ void MainComponent::prepareToPlay(int samplesPerBlockExpected, double sampleRate
         internalSignalBuffer.clear();
         // Do not auto-start; user controls via Start button in Signal Generator UI
     }
+    // Effect work buffers, the audio callback only grows them for oversized blocks
+    effectInputBuffer.setSize(2, samplesPerBlockExpected);
+    effectBuffer.setSize(2, samplesPerBlockExpected);
+    sidechainBuffer.setSize(2, samplesPerBlockExpected);
+
     juce::Logger::writeToLog("prepareToPlay: sampleRate=" + juce::String(sampleRate));
 }
 
@@ -358,8 +231,12 @@ void MainComponent::getNextAudioBlock(const juce::AudioSourceChannelInfo& buffer
     auto numSamples = bufferToFill.numSamples;
     auto buffer = bufferToFill.buffer;
 
-    // If using internal signal generator, render a buffer-aligned block once
-    if (useInternalSignalGen && signalGenEngine)
+    // Sidechain source of the selected effect, sampled once per block
+    auto* selectedEffect = (isEffectEnabled && !isBypassed) ? effectRegistry.getEffect(currentEffectIndex.load()) : nullptr;
+    const auto sidechainSource = selectedEffect != nullptr ? selectedEffect->getSidechainSource() : EffectProcessor::noSidechain;
+
+    // If using internal signal generator (as input or sidechain), render a buffer-aligned block once
+    if ((useInternalSignalGen || sidechainSource == EffectProcessor::signalGeneratorSidechain) && signalGenEngine)
     {
         // Ensure buffer has 2 channels and at least numSamples samples
         if (internalSignalBuffer.getNumChannels() < 2 || internalSignalBuffer.getNumSamples() < numSamples)
@@ -371,7 +248,18 @@ void MainComponent::getNextAudioBlock(const juce::AudioSourceChannelInfo& buffer
         signalGenEngine->processBlock(internalSignalBuffer);
     }
 
-    // Process samples in pairs for proper stereo handling
+    // Work buffers are sized in prepareToPlay; only grow if the device sends a larger block
+    if (effectBuffer.getNumSamples() < numSamples)
+    {
+        effectInputBuffer.setSize(2, numSamples, false, false, true);
+        effectBuffer.setSize(2, numSamples, false, false, true);
+        sidechainBuffer.setSize(2, numSamples, false, false, true);
+    }
+
+    auto* inputL = effectInputBuffer.getWritePointer(0);
+    auto* inputR = effectInputBuffer.getWritePointer(1);
+
+    // Gather stereo input for the whole block
     for (int i = 0; i < numSamples; ++i)
     {
         float leftInput, rightInput;
@@ -381,27 +269,19 @@ void MainComponent::getNextAudioBlock(const juce::AudioSourceChannelInfo& buffer
             leftInput = internalSignalBuffer.getSample(0, i);
             rightInput = internalSignalBuffer.getNumChannels() > 1 ? internalSignalBuffer.getSample(1, i) : leftInput;
         }
-        else if (isSweepTesting && sweepGenerator && sweepGenerator->isSweeeping())
+        else if (isSweepTesting && sweepGenerator)
         {
-            float sweepSample = sweepGenerator->getNextSample();
+            // Silence once the sweep has ended, while its tail comes through the chain;
+            // processSweepTestAudio stops the test when the tail is in
+            float sweepSample = sweepGenerator->isSweeeping() ? sweepGenerator->getNextSample() : 0.0f;
             leftInput = sweepSample;
             rightInput = sweepSample;
-            
-            // Check if sweep test has ended
-            if (!sweepGenerator->isSweeeping())
-            {
-                // Sweep test ended, stop test
-                juce::MessageManager::callAsync([this]() {
-                    stopSweepTest();
-                });
-            }
         }
         else
         {
             leftInput = buffer->getReadPointer(0, bufferToFill.startSample)[i];
             rightInput = (numInputChannels > 1) ? buffer->getReadPointer(1, bufferToFill.startSample)[i] : leftInput;
         }
-       
 
         // Feed spectrum and waveform analyzers (only left channel to avoid duplication)
         if (showInputSpectrumToggle.getToggleState())
@@ -414,26 +294,50 @@ void MainComponent::getNextAudioBlock(const juce::AudioSourceChannelInfo& buffer
             inputWaveformAnalyzer.pushSample(leftInput);
         }
 
-        float leftOutput, rightOutput;
+        inputL[i] = leftInput;
+        inputR[i] = rightInput;
+    }
 
-        if (isBypassed) 
-        {
-            leftOutput = leftInput;
-            rightOutput = rightInput;
-        } 
-        else 
+    // Sidechain from the device input or the signal generator, whichever is not the main input
+    const juce::AudioBuffer<float>* sidechainInput = nullptr;
+    if (sidechainSource == EffectProcessor::deviceInputSidechain && numInputChannels > 0)
+    {
+        for (int channel = 0; channel < 2; ++channel)
+            sidechainBuffer.copyFrom(channel, 0, *buffer, juce::jmin(channel, numInputChannels - 1), bufferToFill.startSample, numSamples);
+        sidechainInput = &sidechainBuffer;
+    }
+    else if (sidechainSource == EffectProcessor::signalGeneratorSidechain && signalGenEngine)
+    {
+        for (int channel = 0; channel < 2; ++channel)
+            sidechainBuffer.copyFrom(channel, 0, internalSignalBuffer, juce::jmin(channel, internalSignalBuffer.getNumChannels() - 1), 0, numSamples);
+        sidechainInput = &sidechainBuffer;
+    }
+
+    // Process effect on the whole block in place
+    effectBuffer.copyFrom(0, 0, effectInputBuffer, 0, 0, numSamples);
+    effectBuffer.copyFrom(1, 0, effectInputBuffer, 1, 0, numSamples);
+
+    if (!isBypassed)
+        processEffectBlock(effectBuffer, numSamples, sidechainInput);
+
+    auto* effectL = effectBuffer.getWritePointer(0);
+    auto* effectR = effectBuffer.getWritePointer(1);
+
+    if (!isBypassed)
+    {
+        // Mono and stereo devices each get a fixed-channel instantiation
+        const int outputChannels = numInputChannels > 1 ? 2 : 1;
+        dispatchChannelCount(outputChannels, [&](auto channelCount)
         {
-            // Process effect with proper stereo handling
-            processEffectStereo(leftInput, rightInput, leftOutput, rightOutput);
-            
-            // Apply gain and EQ processing
-            leftOutput = juce::jlimit(-1.0f, 1.0f, leftOutput * gain);
-            rightOutput = juce::jlimit(-1.0f, 1.0f, rightOutput * gain);
-            
-            InputEqProcess(leftOutput, &leftOutput, eqProcessorL.get());
-            if (numInputChannels > 1)
-                InputEqProcess(rightOutput, &rightOutput, eqProcessorR.get());
-        }
+            processOutputChain<decltype(channelCount)::value>(outputChannels, numSamples);
+        });
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float leftInput = inputL[i];
+        const float leftOutput = effectL[i];
+        const float rightOutput = effectR[i];
 
         if (isSweepTesting)
         {
@@ -465,12 +369,9 @@ void MainComponent::getNextAudioBlock(const juce::AudioSourceChannelInfo& buffer
 
 void MainComponent::releaseResources()
 {
-    // Release noise suppression processor
-    if (noiseSuppressionProcessor)
-    {
-        noiseSuppressionProcessor->releaseResources();
-        noiseSuppressionProcessor.reset();
-    }
+    // Release effect resources (noise suppression state)
+    waitForEffectCapture();
+    effectRegistry.releaseResources();
 }
 
 void MainComponent::paint(juce::Graphics& g)
@@ -478,23 +379,61 @@ void MainComponent::paint(juce::Graphics& g)
     g.fillAll(juce::Colours::darkgrey);
 }
 
-void MainComponent::InputEqProcess(float In1Xn, float *pIn1Yn, IIRFilterProcessor* channelProcessor)
+template <int FixedChannels>
+void MainComponent::processOutputChain(int numChannels, int numSamples)
 {
-    float processedSignal = In1Xn;
-    
-    //Process through the 7-band EQ first
-    if (channelProcessor)
+    const int channelCount = channelsFor<FixedChannels>(numChannels);
+    jassert(channelCount <= 2); // One EQ processor per side
+
+    // Apply gain and clip
+    for (int channel = 0; channel < channelCount; ++channel)
     {
-        processedSignal = channelProcessor->processEQ(processedSignal);
+        auto* data = effectBuffer.getWritePointer(channel);
+        juce::FloatVectorOperations::multiply(data, gain, numSamples);
+        juce::FloatVectorOperations::clip(data, data, -1.0f, 1.0f, numSamples);
     }
-    
-    //Then process through the limiter
-    if (limiterProcessor)
+
+    // Then the EQ; stereo runs both channels, or mid and side, through one SIMD kernel
+    if constexpr (FixedChannels == 2)
     {
-        processedSignal = limiterProcessor->processLimiter(processedSignal);
+        if (eqProcessorL && eqProcessorR)
+            IIRFilterProcessor::processStereoBlock(*eqProcessorL, *eqProcessorR,
+                                                   effectBuffer.getWritePointer(0), effectBuffer.getWritePointer(1), numSamples);
     }
-    
-    *pIn1Yn = processedSignal;
+    else
+    {
+        IIRFilterProcessor* eqProcessors[2] = { eqProcessorL.get(), eqProcessorR.get() };
+        for (int channel = 0; channel < channelCount; ++channel)
+            if (eqProcessors[channel] != nullptr)
+                eqProcessors[channel]->processBlock(effectBuffer.getWritePointer(channel), numSamples);
+    }
+
+    // Then the limiter on the whole block, so the peak stage can oversample
+    if (limiterProcessor)
+        limiterProcessor->processBlock(effectBuffer, channelCount, numSamples);
+}
+
+int MainComponent::getChainLatencySamples() const
+{
+    if (isBypassed)
+        return 0;
+
+    int latency = 0;
+
+    // The effect being captured is skipped, and a captured response keeps the effect's own delay
+    const int effectIndex = currentEffectIndex.load();
+    if (isEffectEnabled && effectIndex != capturingEffectIndex.load())
+        if (auto* effect = effectRegistry.getEffect(effectIndex))
+            latency += effect->getLatencySamples();
+
+    // Both EQ processors share the phase mode
+    if (eqProcessorL)
+        latency += eqProcessorL->getLatencySamples();
+
+    if (limiterProcessor)
+        latency += limiterProcessor->getLatencySamples();
+
+    return latency;
 }
 
 // Helper function to configure sliders
@@ -550,11 +489,13 @@ void MainComponent::startSweepTest()
         
         if (sweepTestWriter != nullptr)
         {
-            // Prepare buffer (2 seconds of recording)
+            // Prepare buffer (2 seconds of recording); the test runs on by the chain latency,
+            // so the output of the whole sweep is in
             int totalSamples = static_cast<int>(currentSampleRate * 2.0);
             sweepTestBuffer.setSize(2, totalSamples);
             sweepTestBuffer.clear();
             sweepTestSampleCount = 0;
+            sweepTestLatency = getChainLatencySamples();
             
             // Start sweep
             sweepGenerator->setFrequencyRange(20.0f, 20000.0f);
@@ -565,7 +506,7 @@ void MainComponent::startSweepTest()
             isSweepTesting = true;
             sweepTestButton.setButtonText("Stop Test");
             
-            DBG("Sweep test started, file: " << sweepTestFile.getFullPathName());
+            DBG("Sweep test started, file: " << sweepTestFile.getFullPathName() << ", chain latency " << sweepTestLatency << " samples");
         }
     }
     
@@ -598,39 +539,56 @@ void MainComponent::processSweepTestAudio(float inputSample, float outputSample)
     if (!sweepTestWriter || !isSweepTesting)
         return;
     
-    // Store input and output simultaneously
-    if (sweepTestSampleCount < sweepTestBuffer.getNumSamples())
-    {
-        // Left channel stores input signal (sweep source)
+    const int totalSamples = sweepTestBuffer.getNumSamples();
+    if (sweepTestSampleCount >= totalSamples + sweepTestLatency)
+        return;
+
+    // Left channel stores input signal (sweep source)
+    if (sweepTestSampleCount < totalSamples)
         sweepTestBuffer.setSample(0, sweepTestSampleCount, inputSample);
-        // Right channel stores output signal (processed)
-        sweepTestBuffer.setSample(1, sweepTestSampleCount, outputSample);
-        
-        sweepTestSampleCount++;
-        
-        // Automatically stop when buffer is full
-        if (sweepTestSampleCount >= sweepTestBuffer.getNumSamples())
-        {
-            juce::MessageManager::callAsync([this]() {
-                stopSweepTest();
-            });
-        }
+
+    // Right channel stores output signal (processed), against the input that produced it
+    const int outputPosition = sweepTestSampleCount - sweepTestLatency;
+    if (outputPosition >= 0)
+        sweepTestBuffer.setSample(1, outputPosition, outputSample);
+
+    sweepTestSampleCount++;
+
+    // Automatically stop when the output of the whole buffer is in
+    if (sweepTestSampleCount >= totalSamples + sweepTestLatency)
+    {
+        juce::MessageManager::callAsync([this]() {
+            stopSweepTest();
+        });
     }
 }
 
 void MainComponent::finalizeSweepTest()
 {
-    if (sweepTestWriter != nullptr && sweepTestSampleCount > 0)
+    // Only samples whose output has come through the chain; less if the test was stopped early
+    const int alignedSamples = juce::jmin(sweepTestBuffer.getNumSamples(), sweepTestSampleCount - sweepTestLatency);
+
+    if (sweepTestWriter != nullptr && alignedSamples > 0)
     {
         // Write audio data
-        sweepTestWriter->writeFromAudioSampleBuffer(sweepTestBuffer, 0, sweepTestSampleCount);
+        sweepTestWriter->writeFromAudioSampleBuffer(sweepTestBuffer, 0, alignedSamples);
         sweepTestWriter.reset();
         
         DBG("Sweep test file saved: " << sweepTestFile.getFullPathName());
         
-        // Use static function to open analyzer window
-        juce::MessageManager::callAsync([this]() {
-            SweepTestAnalyzer::showAnalyzer(sweepTestFile);
+        // Use static function to open analyzer window. The recorded output is the left channel, which
+        // went through the left EQ (or the mid one, the side being silent) unless the chain was bypassed.
+        juce::MessageManager::callAsync([this, eqInPath = !isBypassed]() {
+            juce::Component::SafePointer<MainComponent> safeThis(this);
+            SweepTestAnalyzer::EQResponse measuredEQ;
+            if (eqInPath && eqProcessorL)
+                measuredEQ = [eq = eqProcessorL.get()](float frequency) { return eq->getMagnitudeDb(frequency); };
+
+            SweepTestAnalyzer::showAnalyzer(sweepTestFile, [safeThis](const std::vector<AutoEQFitter::Band>& bands)
+            {
+                if (safeThis != nullptr)
+                    safeThis->applyAutoEQ(bands);
+            }, std::move(measuredEQ));
         });
     }
     
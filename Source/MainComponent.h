@@ -6,14 +6,13 @@
 #include "WaveformAnalyzer.h"
 #include "AudioRecorder.h"
 #include "EQWindow/EQWindow.h"
-#include "EffectEmbeded/effect_delay.h"
-#include "EffectEmbeded/effect_cathedral_reverb.h"
 #include "EffectJUCE/IIRFilterProcessor.h"
 #include "EffectJUCE/LimiterProcessor.h" 
 #include "SweepTestWindow/SweepTestGenerator.h"
 #include "SweepTestWindow/SweepTestAnalyzer.h"
+#include "SweepTestWindow/ImpulseResponseCapture.h"
 #include "SignalGeneratorWindow/SignalGenWindow.h"
-#include "EffectExternal/NoiseSuppressionProcessor.h"
+#include "EffectRegistry/EffectRegistry.h"
 
 class MainComponent : public juce::AudioAppComponent,
     public juce::Slider::Listener,
@@ -34,7 +33,6 @@ public:
     void sliderValueChanged(juce::Slider* slider) override;
     void comboBoxChanged(juce::ComboBox* comboBox) override;
     void buttonClicked(juce::Button* button) override; // Added for ToggleButton::Listener
-    void InputEqProcess(float In1Xn, float* pIn1Yn, IIRFilterProcessor* channelProcessor);
     void handleCommandMessage(int commandId) override;
 private:
     // UI controls
@@ -43,62 +41,24 @@ private:
     juce::Label effectSelectorLabel;
     juce::ToggleButton effectEnableToggle;
     
-    // Effect parameters
-    juce::Slider gainSlider, delaySlider, feedbackSlider, flangerRateSlider, flangerDepthSlider;
-    juce::Label gainLabel, delayLabel, feedbackLabel, flangerRateLabel, flangerDepthLabel;
-    
-    // Plate reverb parameters
-    juce::Slider plateDecaySlider, plateToneSlider;
-    juce::Label plateDecayLabel, plateToneLabel;
-    
-    // Pitch shift parameters
-    juce::Slider pitchSemitoneSlider, pitchDetuneSlider;
-    juce::Label pitchSemitoneLabel, pitchDetuneLabel;
-    
-    // Cathedral reverb parameters
-    juce::Slider cathedralDecaySlider, cathedralToneSlider;
-    juce::Label cathedralDecayLabel, cathedralToneLabel;
-    
-    // JUCE Delay parameters
-    juce::Slider juceDelayTimeSlider, juceDelayFeedbackSlider, juceDelayMixSlider;
-    juce::Label juceDelayTimeLabel, juceDelayFeedbackLabel, juceDelayMixLabel;
-    
-    // JUCE Chorus parameters
-    juce::Slider juceChorusRateSlider, juceChorusDepthSlider, juceChorusCentreDelaySlider, juceChorusFeedbackSlider, juceChorusMixSlider;
-    juce::Label juceChorusRateLabel, juceChorusDepthLabel, juceChorusCentreDelayLabel, juceChorusFeedbackLabel, juceChorusMixLabel;
-    
-    // JUCE Reverb parameters
-    juce::Slider juceReverbRoomSizeSlider, juceReverbDampingSlider, juceReverbWetLevelSlider, juceReverbDryLevelSlider, juceReverbWidthSlider;
-    juce::Label juceReverbRoomSizeLabel, juceReverbDampingLabel, juceReverbWetLevelLabel, juceReverbDryLevelLabel, juceReverbWidthLabel;
-    
-    // JUCE Phaser parameters
-    juce::Slider jucePhaserRateSlider, jucePhaserDepthSlider, jucePhaserCentreFreqSlider, jucePhaserFeedbackSlider, jucePhaserMixSlider;
-    juce::Label jucePhaserRateLabel, jucePhaserDepthLabel, jucePhaserCentreFreqLabel, jucePhaserFeedbackLabel, jucePhaserMixLabel;
-    
-    // JUCE Compressor parameters
-    juce::Slider juceCompressorThresholdSlider, juceCompressorRatioSlider, juceCompressorAttackSlider, juceCompressorReleaseSlider;
-    juce::Label juceCompressorThresholdLabel, juceCompressorRatioLabel, juceCompressorAttackLabel, juceCompressorReleaseLabel;
-    
-    // JUCE Distortion parameters
-    // JUCE Flanger parameters
-    juce::Slider juceFlangerRateSlider, juceFlangerDepthSlider, juceFlangerCentreDelaySlider, juceFlangerFeedbackSlider, juceFlangerMixSlider;
-    juce::Label juceFlangerRateLabel, juceFlangerDepthLabel, juceFlangerCentreDelayLabel, juceFlangerFeedbackLabel, juceFlangerMixLabel;
-    
-    // JUCE Pitch Shift parameters
-    juce::Slider jucePitchShiftSlider;
-    juce::Label jucePitchShiftLabel;
-    
-    // JUCE Plate Reverb parameters
-    juce::Slider jucePlateReverbRoomSizeSlider, jucePlateReverbDampingSlider, jucePlateReverbWetLevelSlider;
-    juce::Label jucePlateReverbRoomSizeLabel, jucePlateReverbDampingLabel, jucePlateReverbWetLevelLabel;
-    
-    // JUCE Distortion parameters
-    juce::Slider juceDistortionDriveSlider, juceDistortionRangeSlider, juceDistortionBlendSlider;
-    juce::Label juceDistortionDriveLabel, juceDistortionRangeLabel, juceDistortionBlendLabel;
-
-    // Noise Suppression parameters
-    juce::Slider noiseSuppressionVadThresholdSlider, noiseSuppressionVadGracePeriodSlider, noiseSuppressionVadRetroactiveGracePeriodSlider;
-    juce::Label noiseSuppressionVadThresholdLabel, noiseSuppressionVadGracePeriodLabel, noiseSuppressionVadRetroactiveGracePeriodLabel;
+    // Gain
+    juce::Slider gainSlider;
+    juce::Label gainLabel;
+
+    // Controls generated from the selected effect's parameter descriptors
+    struct EffectControl
+    {
+        static constexpr int fileSlot = -1;    // parameterIndex of the file button
+        static constexpr int captureSlot = -2; // parameterIndex of the capture button
+
+        int parameterIndex = 0;
+        std::unique_ptr<juce::Slider> slider;
+        std::unique_ptr<juce::ComboBox> choice;
+        std::unique_ptr<juce::TextButton> button;
+        std::unique_ptr<juce::Label> label;
+    };
+    std::vector<EffectControl> effectControls;
+    std::unique_ptr<juce::FileChooser> effectFileChooser;
 
     juce::ToggleButton bypassToggle;
     juce::TextButton recordButton;
@@ -124,92 +84,14 @@ private:
 
     // Audio processing
     float gain = 1.0f;
-    float delayTime = 0.5f;
-    float feedbackGain = 0.5f;
-    float flangerRate = 0.5f;
-    float flangerDepth = 0.5f;
-    float plateDecay = 0.5f;
-    float plateTone = 0.5f;
-    float pitchSemitone = 0.5f;
-    float pitchDetune = 0.5f;
-    float cathedralDecay = 0.5f;
-    float cathedralTone = 0.5f;
-    
-    // JUCE effect parameters
-    float juceDelayTime = 0.5f;
-    float juceDelayFeedback = 0.3f;
-    float juceDelayMix = 0.5f;
-    
-    float juceChorusRate = 1.0f;
-    float juceChorusDepth = 0.25f;
-    float juceChorusCentreDelay = 7.0f;
-    float juceChorusFeedback = 0.0f;
-    float juceChorusMix = 0.5f;
-    
-    float juceReverbRoomSize = 0.5f;
-    float juceReverbDamping = 0.5f;
-    float juceReverbWetLevel = 0.33f;
-    float juceReverbDryLevel = 0.4f;
-    float juceReverbWidth = 1.0f;
-    
-    float jucePhaserRate = 1.0f;
-    float jucePhaserDepth = 1.0f;
-    float jucePhaserCentreFreq = 1300.0f;
-    float jucePhaserFeedback = 0.0f;
-    float jucePhaserMix = 0.5f;
-    
-    float juceCompressorThreshold = -10.0f;
-    float juceCompressorRatio = 4.0f;
-    float juceCompressorAttack = 2.0f;
-    float juceCompressorRelease = 100.0f;
-    
-    float juceFlangerRate = 1.0f;
-    float juceFlangerDepth = 0.25f;
-    float juceFlangerCentreDelay = 7.0f;
-    float juceFlangerFeedback = 0.0f;
-    float juceFlangerMix = 0.5f;
-    
-    float jucePitchShift = 0.0f; // In semitones
-    
-    float jucePlateReverbRoomSize = 0.5f;
-    float jucePlateReverbDamping = 0.5f;
-    float jucePlateReverbWetLevel = 0.33f;
-    
-    float juceDistortionDrive = 0.5f;
-    float juceDistortionRange = 0.5f;
-    float juceDistortionBlend = 0.5f;
-
-    // Noise Suppression parameters
-    float noiseSuppressionVadThreshold = 0.6f;
-    int noiseSuppressionVadGracePeriod = 20;
-    int noiseSuppressionVadRetroactiveGracePeriod = 0;
 
     double currentSampleRate = 44100.0;
     
-    // Current effect
-    enum EffectType {
-        Delay, Flanger, PlateReverb, PitchShift, CathedralReverb,
-        JUCEDelay, JUCEFlanger, JUCEPitchShift, JUCEPlateReverb, JUCEChorus, JUCEReverb, JUCEPhaser, JUCECompressor, JUCEDistortion, NoiseSuppression
-    };
-    EffectType currentEffect = Delay;
-
-    // JUCE DSP effects
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> juceDelay;
-    juce::dsp::Chorus<float> juceFlanger;        // Used for flanger effect
-    juce::dsp::Chorus<float> juceChorus;         // Used for chorus effect  
-    juce::dsp::Reverb jucePlateReverb;           // Used for plate reverb effect
-    juce::dsp::Reverb juceReverb;                // Used for standard reverb effect
-    juce::dsp::Phaser<float> jucePhaser;
-    juce::dsp::Compressor<float> juceCompressor;
-    juce::dsp::WaveShaper<float> juceDistortion;
-
-    // Noise Suppression processor
-    std::unique_ptr<NoiseSuppressionProcessor> noiseSuppressionProcessor;
-
     // DSP context
     juce::dsp::ProcessSpec spec;
-    juce::dsp::AudioBlock<float> audioBlock;
-    juce::HeapBlock<char> heapBlock;
+    juce::AudioBuffer<float> effectInputBuffer; // Stereo input of the current callback
+    juce::AudioBuffer<float> effectBuffer;      // Stereo work buffer, effects process it in place
+    juce::AudioBuffer<float> sidechainBuffer;   // Stereo sidechain of the selected effect, if it takes one
 
     // Bypass related
     bool isBypassed = false;
@@ -229,8 +111,9 @@ private:
     std::unique_ptr<SweepTestGenerator> sweepGenerator;
     std::unique_ptr<juce::AudioFormatWriter> sweepTestWriter;
     juce::File sweepTestFile;
-    juce::AudioBuffer<float> sweepTestBuffer;
-    int sweepTestSampleCount = 0;
+    juce::AudioBuffer<float> sweepTestBuffer;   // Input and output of the sweep, aligned by sweepTestLatency
+    int sweepTestSampleCount = 0;               // Callback samples so far, up to the buffer plus the latency
+    int sweepTestLatency = 0;                   // Chain latency when the test started
     bool isSweepTesting = false;
 
     // Signal generator integration
@@ -243,47 +126,32 @@ private:
 
     const float maxDelayTime = 2.0f; // seconds
 
+    // Effects, indexed by effect selector id - 1
+    EffectRegistry effectRegistry { maxDelayTime };
+    std::atomic<int> currentEffectIndex { 0 };
+
+    // Impulse response capture; the audio callback skips the effect being rendered (-1: none).
+    // Declared after the registry so pending jobs finish before the effects are destroyed.
+    std::atomic<int> capturingEffectIndex { -1 };
+    juce::ThreadPool captureThreadPool { 1 };
+
     void updateDeviceLists();
-    void updateEffectControls();
-    void hideAllEffectControls();
+    void rebuildEffectControls();
+    void layoutEffectControls();
+    void chooseEffectFile();
+    void toggleEffectCapture();
+    void finishEffectCapture(int effectIndex, int impulseResponseLength, double impulseSampleRate);
+    void waitForEffectCapture();
     void configureSlider(juce::Slider& slider, juce::Label& label, const juce::String& labelText, 
                         double minValue, double maxValue, double initialValue);
-    void processEffectStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
+    void processEffectBlock(juce::AudioBuffer<float>& buffer, int numSamples, const juce::AudioBuffer<float>* sidechainInput);
+    template <int FixedChannels>
+    void processOutputChain(int numChannels, int numSamples); // Gain, EQ and limiter on effectBuffer
+
+    // Samples the output lags the input by through the selected effect, the EQ and the limiter (message thread)
+    int getChainLatencySamples() const;
     void logParameterUpdate(const juce::String& parameterName, float value);
     
-    // JUCE effect processing functions (mono)
-    float processJUCEDelay(float inputSample);
-    float processJUCEFlanger(float inputSample);
-    float processJUCEPitchShift(float inputSample);
-    float processJUCEPlateReverb(float inputSample);
-    float processJUCEChorus(float inputSample);
-    float processJUCEReverb(float inputSample);
-    float processJUCEPhaser(float inputSample);
-    float processJUCECompressor(float inputSample);
-    float processJUCEDistortion(float inputSample);
-    
-    // JUCE effect processing functions (stereo)
-    void processJUCEDelayStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEFlangerStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEPitchShiftStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEPlateReverbStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEChorusStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEReverbStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEPhaserStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCECompressorStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    void processJUCEDistortionStereo(float leftInput, float rightInput, float& leftOutput, float& rightOutput);
-    
-    // JUCE effect parameter update functions
-    void updateJUCEDelayParameters();
-    void updateJUCEFlangerParameters();
-    void updateJUCEPitchShiftParameters();
-    void updateJUCEPlateReverbParameters();
-    void updateJUCEChorusParameters();
-    void updateJUCEReverbParameters();
-    void updateJUCEPhaserParameters();
-    void updateJUCECompressorParameters();
-    void updateJUCEDistortionParameters();
-    
     // Sweep test methods
     void startSweepTest();
     void stopSweepTest();
@@ -291,5 +159,6 @@ private:
     void finalizeSweepTest();
     void openEQWindow();
     void closeEQWindow();
+    void applyAutoEQ(const std::vector<AutoEQFitter::Band>& bands);
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MainComponent)
 };
\ No newline at end of file
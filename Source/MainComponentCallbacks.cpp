@@ -6,244 +6,20 @@ void MainComponent::sliderValueChanged(juce::Slider* slider)
     {
         gain = static_cast<float>(gainSlider.getValue());
     }
-    else if (slider == &delaySlider)
-    {
-        delayTime = static_cast<float>(delaySlider.getValue());
-        FxDelayParaUpdate(feedbackGain, delayTime);
-        logParameterUpdate("Delay time", delayTime);
-    }
-    else if (slider == &feedbackSlider)
-    {
-        feedbackGain = static_cast<float>(feedbackSlider.getValue());
-        FxDelayParaUpdate(feedbackGain, delayTime);
-        logParameterUpdate("Feedback gain", feedbackGain);
-    }
-    else if (slider == &flangerRateSlider)
-    {
-        flangerRate = static_cast<float>(flangerRateSlider.getValue());
-        //FxFlangerParaUpdate(flangerRate, flangerDepth);
-        logParameterUpdate("Flanger rate", flangerRate);
-    }
-    else if (slider == &flangerDepthSlider)
-    {
-        flangerDepth = static_cast<float>(flangerDepthSlider.getValue());
-        //FxFlangerParaUpdate(flangerRate, flangerDepth);
-        logParameterUpdate("Flanger depth", flangerDepth);
-    }
-    else if (slider == &plateDecaySlider)
-    {
-        plateDecay = static_cast<float>(plateDecaySlider.getValue());
-        //FxPlateRevbParaUpdate(plateDecay, plateTone);
-        logParameterUpdate("Plate reverb decay", plateDecay);
-    }
-    else if (slider == &plateToneSlider)
-    {
-        plateTone = static_cast<float>(plateToneSlider.getValue());
-        //FxPlateRevbParaUpdate(plateDecay, plateTone);
-        logParameterUpdate("Plate reverb tone", plateTone);
-    }
-    else if (slider == &pitchSemitoneSlider)
-    {
-        pitchSemitone = static_cast<float>(pitchSemitoneSlider.getValue());
-        //FxPitchParaUpdate(pitchSemitone, pitchDetune);
-        logParameterUpdate("Pitch semitone", pitchSemitone);
-    }
-    else if (slider == &pitchDetuneSlider)
-    {
-        pitchDetune = static_cast<float>(pitchDetuneSlider.getValue());
-        //FxPitchParaUpdate(pitchSemitone, pitchDetune);
-        logParameterUpdate("Pitch detune", pitchDetune);
-    }
-    else if (slider == &cathedralDecaySlider)
-    {
-        cathedralDecay = static_cast<float>(cathedralDecaySlider.getValue());
-        FxCathedralRevbParaUpdate(cathedralDecay, cathedralTone);
-        logParameterUpdate("Cathedral reverb decay", cathedralDecay);
-    }
-    else if (slider == &cathedralToneSlider)
-    {
-        cathedralTone = static_cast<float>(cathedralToneSlider.getValue());
-        FxCathedralRevbParaUpdate(cathedralDecay, cathedralTone);
-        logParameterUpdate("Cathedral reverb tone", cathedralTone);
-    }
-    // JUCE effect parameter handling
-    else if (slider == &juceDelayTimeSlider)
-    {
-        juceDelayTime = static_cast<float>(juceDelayTimeSlider.getValue());
-        updateJUCEDelayParameters();
-        logParameterUpdate("JUCE Delay time", juceDelayTime);
-    }
-    else if (slider == &juceDelayFeedbackSlider)
-    {
-        juceDelayFeedback = static_cast<float>(juceDelayFeedbackSlider.getValue());
-        updateJUCEDelayParameters();
-        logParameterUpdate("JUCE Delay feedback", juceDelayFeedback);
-    }
-    else if (slider == &juceDelayMixSlider)
-    {
-        juceDelayMix = static_cast<float>(juceDelayMixSlider.getValue());
-        updateJUCEDelayParameters();
-        logParameterUpdate("JUCE Delay mix", juceDelayMix);
-    }
-    else if (slider == &juceChorusRateSlider)
-    {
-        juceChorusRate = static_cast<float>(juceChorusRateSlider.getValue());
-        updateJUCEChorusParameters();
-        logParameterUpdate("JUCE Chorus rate", juceChorusRate);
-    }
-    else if (slider == &juceChorusDepthSlider)
-    {
-        juceChorusDepth = static_cast<float>(juceChorusDepthSlider.getValue());
-        updateJUCEChorusParameters();
-        logParameterUpdate("JUCE Chorus depth", juceChorusDepth);
-    }
-    else if (slider == &juceChorusCentreDelaySlider)
-    {
-        juceChorusCentreDelay = static_cast<float>(juceChorusCentreDelaySlider.getValue());
-        updateJUCEChorusParameters();
-        logParameterUpdate("JUCE Chorus centre delay", juceChorusCentreDelay);
-    }
-    else if (slider == &juceChorusFeedbackSlider)
-    {
-        juceChorusFeedback = static_cast<float>(juceChorusFeedbackSlider.getValue());
-        updateJUCEChorusParameters();
-        logParameterUpdate("JUCE Chorus feedback", juceChorusFeedback);
-    }
-    else if (slider == &juceChorusMixSlider)
-    {
-        juceChorusMix = static_cast<float>(juceChorusMixSlider.getValue());
-        updateJUCEChorusParameters();
-        logParameterUpdate("JUCE Chorus mix", juceChorusMix);
-    }
-    else if (slider == &juceReverbRoomSizeSlider)
-    {
-        juceReverbRoomSize = static_cast<float>(juceReverbRoomSizeSlider.getValue());
-        updateJUCEReverbParameters();
-        logParameterUpdate("JUCE Reverb room size", juceReverbRoomSize);
-    }
-    else if (slider == &juceReverbDampingSlider)
-    {
-        juceReverbDamping = static_cast<float>(juceReverbDampingSlider.getValue());
-        updateJUCEReverbParameters();
-        logParameterUpdate("JUCE Reverb damping", juceReverbDamping);
-    }
-    else if (slider == &juceReverbWetLevelSlider)
-    {
-        juceReverbWetLevel = static_cast<float>(juceReverbWetLevelSlider.getValue());
-        updateJUCEReverbParameters();
-        logParameterUpdate("JUCE Reverb wet level", juceReverbWetLevel);
-    }
-    else if (slider == &juceReverbDryLevelSlider)
-    {
-        juceReverbDryLevel = static_cast<float>(juceReverbDryLevelSlider.getValue());
-        updateJUCEReverbParameters();
-        logParameterUpdate("JUCE Reverb dry level", juceReverbDryLevel);
-    }
-    else if (slider == &juceReverbWidthSlider)
-    {
-        juceReverbWidth = static_cast<float>(juceReverbWidthSlider.getValue());
-        updateJUCEReverbParameters();
-        logParameterUpdate("JUCE Reverb width", juceReverbWidth);
-    }
-    else if (slider == &jucePhaserRateSlider)
-    {
-        jucePhaserRate = static_cast<float>(jucePhaserRateSlider.getValue());
-        updateJUCEPhaserParameters();
-        logParameterUpdate("JUCE Phaser rate", jucePhaserRate);
-    }
-    else if (slider == &jucePhaserDepthSlider)
-    {
-        jucePhaserDepth = static_cast<float>(jucePhaserDepthSlider.getValue());
-        updateJUCEPhaserParameters();
-        logParameterUpdate("JUCE Phaser depth", jucePhaserDepth);
-    }
-    else if (slider == &jucePhaserCentreFreqSlider)
-    {
-        jucePhaserCentreFreq = static_cast<float>(jucePhaserCentreFreqSlider.getValue());
-        updateJUCEPhaserParameters();
-        logParameterUpdate("JUCE Phaser centre freq", jucePhaserCentreFreq);
-    }
-    else if (slider == &jucePhaserFeedbackSlider)
-    {
-        jucePhaserFeedback = static_cast<float>(jucePhaserFeedbackSlider.getValue());
-        updateJUCEPhaserParameters();
-        logParameterUpdate("JUCE Phaser feedback", jucePhaserFeedback);
-    }
-    else if (slider == &jucePhaserMixSlider)
-    {
-        jucePhaserMix = static_cast<float>(jucePhaserMixSlider.getValue());
-        updateJUCEPhaserParameters();
-        logParameterUpdate("JUCE Phaser mix", jucePhaserMix);
-    }
-    else if (slider == &juceCompressorThresholdSlider)
-    {
-        juceCompressorThreshold = static_cast<float>(juceCompressorThresholdSlider.getValue());
-        updateJUCECompressorParameters();
-        logParameterUpdate("JUCE Compressor threshold", juceCompressorThreshold);
-    }
-    else if (slider == &juceCompressorRatioSlider)
-    {
-        juceCompressorRatio = static_cast<float>(juceCompressorRatioSlider.getValue());
-        updateJUCECompressorParameters();
-        logParameterUpdate("JUCE Compressor ratio", juceCompressorRatio);
-    }
-    else if (slider == &juceCompressorAttackSlider)
-    {
-        juceCompressorAttack = static_cast<float>(juceCompressorAttackSlider.getValue());
-        updateJUCECompressorParameters();
-        logParameterUpdate("JUCE Compressor attack", juceCompressorAttack);
-    }
-    else if (slider == &juceCompressorReleaseSlider)
-    {
-        juceCompressorRelease = static_cast<float>(juceCompressorReleaseSlider.getValue());
-        updateJUCECompressorParameters();
-        logParameterUpdate("JUCE Compressor release", juceCompressorRelease);
-    }
-    else if (slider == &juceDistortionDriveSlider)
-    {
-        juceDistortionDrive = static_cast<float>(juceDistortionDriveSlider.getValue());
-        updateJUCEDistortionParameters();
-        logParameterUpdate("JUCE Distortion drive", juceDistortionDrive);
-    }
-    else if (slider == &juceDistortionRangeSlider)
-    {
-        juceDistortionRange = static_cast<float>(juceDistortionRangeSlider.getValue());
-        updateJUCEDistortionParameters();
-        logParameterUpdate("JUCE Distortion range", juceDistortionRange);
-    }
-    else if (slider == &juceDistortionBlendSlider)
-    {
-        juceDistortionBlend = static_cast<float>(juceDistortionBlendSlider.getValue());
-        updateJUCEDistortionParameters();
-        logParameterUpdate("JUCE Distortion blend", juceDistortionBlend);
-    }
-    // Noise Suppression parameter handling
-    else if (slider == &noiseSuppressionVadThresholdSlider)
-    {
-        noiseSuppressionVadThreshold = static_cast<float>(noiseSuppressionVadThresholdSlider.getValue());
-        if (noiseSuppressionProcessor)
-        {
-            noiseSuppressionProcessor->setVadThreshold(noiseSuppressionVadThreshold);
-        }
-        logParameterUpdate("Noise Suppression VAD Threshold", noiseSuppressionVadThreshold);
-    }
-    else if (slider == &noiseSuppressionVadGracePeriodSlider)
-    {
-        noiseSuppressionVadGracePeriod = static_cast<int>(noiseSuppressionVadGracePeriodSlider.getValue());
-        if (noiseSuppressionProcessor)
-        {
-            noiseSuppressionProcessor->setVadGracePeriod(noiseSuppressionVadGracePeriod);
-        }
-        logParameterUpdate("Noise Suppression VAD Grace Period", static_cast<float>(noiseSuppressionVadGracePeriod));
-    }
-    else if (slider == &noiseSuppressionVadRetroactiveGracePeriodSlider)
+    else
     {
-        noiseSuppressionVadRetroactiveGracePeriod = static_cast<int>(noiseSuppressionVadRetroactiveGracePeriodSlider.getValue());
-        if (noiseSuppressionProcessor)
+        // Generated effect parameter controls
+        auto* effect = effectRegistry.getEffect(currentEffectIndex.load());
+        for (auto& control : effectControls)
         {
-            noiseSuppressionProcessor->setVadRetroactiveGracePeriod(noiseSuppressionVadRetroactiveGracePeriod);
+            if (effect != nullptr && control.slider.get() == slider)
+            {
+                const auto& parameter = effect->getParameters()[static_cast<size_t>(control.parameterIndex)];
+                effect->setParameter(control.parameterIndex, static_cast<float>(slider->getValue()));
+                logParameterUpdate(effect->getName() + " " + parameter.name, static_cast<float>(slider->getValue()));
+                break;
+            }
         }
-        logParameterUpdate("Noise Suppression VAD Retroactive Grace Period", static_cast<float>(noiseSuppressionVadRetroactiveGracePeriod));
     }
 }
 
@@ -261,7 +37,7 @@ void MainComponent::buttonClicked(juce::Button* button)
         {
             if (!audioRecorder->isRecording())
             {
-                audioRecorder->startRecording(currentSampleRate);
+                audioRecorder->startRecording(currentSampleRate, getChainLatencySamples());
                 recordButton.setButtonText("Stop Recording");
             }
             else
@@ -307,6 +83,21 @@ void MainComponent::buttonClicked(juce::Button* button)
         isEffectEnabled = effectEnableToggle.getToggleState();
         logParameterUpdate("Effect", isEffectEnabled ? 1.0f : 0.0f);
     }
+    else
+    {
+        // Generated effect file and capture controls
+        for (auto& control : effectControls)
+        {
+            if (control.button.get() == button)
+            {
+                if (control.parameterIndex == EffectControl::fileSlot)
+                    chooseEffectFile();
+                else if (control.parameterIndex == EffectControl::captureSlot)
+                    toggleEffectCapture();
+                break;
+            }
+        }
+    }
 }
 
 void MainComponent::openEQWindow()
@@ -318,7 +109,7 @@ void MainComponent::openEQWindow()
         
         if (eqWindow)
         {
-            // Synchronize right channel EQ parameters with left channel EQ
+            // Right channel EQ (side in mid/side mode); it shares the left curve while the window is linked
             eqWindow->setSecondEQProcessor(eqProcessorR.get());
         }
 
@@ -373,6 +164,16 @@ void MainComponent::closeEQWindow()
     }
 }
 
+void MainComponent::applyAutoEQ(const std::vector<AutoEQFitter::Band>& bands)
+{
+    // Fitted from a sweep analysis; shown in the EQ window so it can be adjusted and saved
+    if (!eqWindow || !eqWindow->isVisible())
+        openEQWindow();
+
+    if (eqWindow)
+        eqWindow->applyAutoEQ(bands);
+}
+
 void MainComponent::handleCommandMessage(int commandId)
 {
     if (commandId == 0x1000)  // Custom message from EQWindow
@@ -385,70 +186,34 @@ void MainComponent::comboBoxChanged(juce::ComboBox* comboBox)
     if (comboBox == &effectSelector)
     {
         // Handle effect selection
-        int selectedId = effectSelector.getSelectedId();
-        if (selectedId == 1) // Delay
-        {
-            currentEffect = Delay;
-            juce::Logger::writeToLog("Effect changed to: Delay");
-        }
-        else if (selectedId == 2) // Flanger
-        {
-            currentEffect = Flanger;
-            juce::Logger::writeToLog("Effect changed to: Flanger");
-        }
-        else if (selectedId == 3) // Plate Reverb
-        {
-            currentEffect = PlateReverb;
-            juce::Logger::writeToLog("Effect changed to: Plate Reverb");
-        }
-        else if (selectedId == 4) // Pitch Shift
-        {
-            currentEffect = PitchShift;
-            juce::Logger::writeToLog("Effect changed to: Pitch Shift");
-        }
-        else if (selectedId == 5) // Cathedral Reverb
-        {
-            currentEffect = CathedralReverb;
-            juce::Logger::writeToLog("Effect changed to: Cathedral Reverb");
-        }
-        else if (selectedId == 6) // JUCE Delay
-        {
-            currentEffect = JUCEDelay;
-            juce::Logger::writeToLog("Effect changed to: JUCE Delay");
-        }
-        else if (selectedId == 7) // JUCE Chorus
-        {
-            currentEffect = JUCEChorus;
-            juce::Logger::writeToLog("Effect changed to: JUCE Chorus");
-        }
-        else if (selectedId == 8) // JUCE Reverb
-        {
-            currentEffect = JUCEReverb;
-            juce::Logger::writeToLog("Effect changed to: JUCE Reverb");
-        }
-        else if (selectedId == 9) // JUCE Phaser
-        {
-            currentEffect = JUCEPhaser;
-            juce::Logger::writeToLog("Effect changed to: JUCE Phaser");
-        }
-        else if (selectedId == 10) // JUCE Compressor
-        {
-            currentEffect = JUCECompressor;
-            juce::Logger::writeToLog("Effect changed to: JUCE Compressor");
-        }
-        else if (selectedId == 11) // JUCE Distortion
-        {
-            currentEffect = JUCEDistortion;
-            juce::Logger::writeToLog("Effect changed to: JUCE Distortion");
-        }
-        else if (selectedId == 12) // Noise Suppression
+        currentEffectIndex.store(effectSelector.getSelectedId() - 1);
+        
+        if (auto* effect = effectRegistry.getEffect(currentEffectIndex.load()))
         {
-            currentEffect = NoiseSuppression;
-            juce::Logger::writeToLog("Effect changed to: Noise Suppression");
+            juce::Logger::writeToLog("Effect changed to: " + effect->getName()
+                                     + " (latency " + juce::String(effect->getLatencySamples()) + " samples, chain "
+                                     + juce::String(getChainLatencySamples()) + ")");
         }
 
         // Update control display
-        updateEffectControls();
+        rebuildEffectControls();
+    }
+    else if (comboBox != &inputDeviceSelector && comboBox != &outputDeviceSelector)
+    {
+        // Generated effect choice controls
+        auto* effect = effectRegistry.getEffect(currentEffectIndex.load());
+        for (auto& control : effectControls)
+        {
+            if (effect != nullptr && control.choice.get() == comboBox)
+            {
+                const auto& parameter = effect->getParameters()[static_cast<size_t>(control.parameterIndex)];
+                effect->setParameter(control.parameterIndex, static_cast<float>(comboBox->getSelectedItemIndex()));
+                juce::Logger::writeToLog(effect->getName() + " " + parameter.name + " changed to: " + comboBox->getText()
+                                         + " (latency " + juce::String(effect->getLatencySamples()) + " samples, chain "
+                                         + juce::String(getChainLatencySamples()) + ")");
+                break;
+            }
+        }
     }
     else
     {
@@ -0,0 +1,586 @@
+// AutoEQFitter.cpp
+#include "AutoEQFitter.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using FilterType = IIRFilterProcessor::FilterType;
+
+namespace
+{
+    // Averages the points within 1/12 octave either side of each grid frequency (1/6 octave smoothing),
+    // interpolating in log frequency where the curve has no points that close
+    std::vector<float> resampleCurve(const std::vector<float>& frequencies, const std::vector<float>& db,
+                                     const std::vector<float>& grid)
+    {
+        std::vector<float> result(grid.size(), 0.0f);
+        const size_t numPoints = juce::jmin(frequencies.size(), db.size());
+        if (numPoints == 0)
+            return result;
+
+        const float halfWidth = std::pow(2.0f, 1.0f / 12.0f);
+        size_t first = 0;
+
+        for (size_t g = 0; g < grid.size(); ++g)
+        {
+            const float low = grid[g] / halfWidth;
+            const float high = grid[g] * halfWidth;
+
+            while (first < numPoints && frequencies[first] < low)
+                ++first;
+
+            double sum = 0.0;
+            int count = 0;
+            for (size_t i = first; i < numPoints && frequencies[i] <= high; ++i)
+            {
+                sum += db[i];
+                ++count;
+            }
+
+            if (count > 0)
+            {
+                result[g] = static_cast<float>(sum / count);
+            }
+            else if (first == 0)
+            {
+                result[g] = db[0];
+            }
+            else if (first >= numPoints)
+            {
+                result[g] = db[numPoints - 1];
+            }
+            else
+            {
+                const float f0 = std::log(juce::jmax(frequencies[first - 1], 1.0e-3f));
+                const float f1 = std::log(juce::jmax(frequencies[first], 1.0e-3f));
+                const float t = f1 > f0 ? (std::log(grid[g]) - f0) / (f1 - f0) : 0.0f;
+                result[g] = db[first - 1] + juce::jlimit(0.0f, 1.0f, t) * (db[first] - db[first - 1]);
+            }
+        }
+
+        return result;
+    }
+
+    // Solves the n x n system in place by Gaussian elimination with partial pivoting; b becomes the solution
+    bool solveLinearSystem(std::vector<double>& a, std::vector<double>& b, int n)
+    {
+        for (int column = 0; column < n; ++column)
+        {
+            int pivot = column;
+            for (int row = column + 1; row < n; ++row)
+                if (std::abs(a[(size_t) (row * n + column)]) > std::abs(a[(size_t) (pivot * n + column)]))
+                    pivot = row;
+
+            if (std::abs(a[(size_t) (pivot * n + column)]) < 1.0e-12)
+                return false;
+
+            if (pivot != column)
+            {
+                for (int k = 0; k < n; ++k)
+                    std::swap(a[(size_t) (pivot * n + k)], a[(size_t) (column * n + k)]);
+                std::swap(b[(size_t) pivot], b[(size_t) column]);
+            }
+
+            for (int row = column + 1; row < n; ++row)
+            {
+                const double factor = a[(size_t) (row * n + column)] / a[(size_t) (column * n + column)];
+                for (int k = column; k < n; ++k)
+                    a[(size_t) (row * n + k)] -= factor * a[(size_t) (column * n + k)];
+                b[(size_t) row] -= factor * b[(size_t) column];
+            }
+        }
+
+        for (int row = n - 1; row >= 0; --row)
+        {
+            double sum = b[(size_t) row];
+            for (int k = row + 1; k < n; ++k)
+                sum -= a[(size_t) (row * n + k)] * b[(size_t) k];
+            b[(size_t) row] = sum / a[(size_t) (row * n + row)];
+        }
+        return true;
+    }
+}
+
+AutoEQFitter::AutoEQFitter(const std::vector<float>& frequencies, const std::vector<float>& measuredDb,
+                           const std::vector<float>& targetFrequencies, const std::vector<float>& targetDb,
+                           double sr, const Options& fitOptions)
+    : sampleRate(sr), options(fitOptions)
+{
+    // designFilter bypasses bands at 20 Hz and below; near Nyquist the grid would only see the bilinear warp
+    options.numBands = juce::jlimit(1, IIRFilterProcessor::maxBands, options.numBands);
+    options.minFrequency = juce::jmax(25.0f, options.minFrequency);
+    options.maxFrequency = juce::jmax(options.minFrequency * 2.0f, juce::jmin(options.maxFrequency, static_cast<float>(sr * 0.45)));
+
+    gridFrequencies.resize(gridSize);
+    phi.resize(gridSize);
+    phiSquared.resize(gridSize);
+    for (int i = 0; i < gridSize; ++i)
+    {
+        const float proportion = static_cast<float>(i) / static_cast<float>(gridSize - 1);
+        const float freq = options.minFrequency * std::pow(options.maxFrequency / options.minFrequency, proportion);
+        const double omega = juce::MathConstants<double>::twoPi * freq / sampleRate;
+        gridFrequencies[(size_t) i] = freq;
+        const double s = std::sin(omega / 2.0);
+        phi[(size_t) i] = static_cast<float>(s * s);
+        phiSquared[(size_t) i] = static_cast<float>(s * s * s * s);
+    }
+
+    const auto measured = resampleCurve(frequencies, measuredDb, gridFrequencies);
+    const auto target = resampleCurve(targetFrequencies, targetDb, gridFrequencies);
+
+    desiredDb.resize(gridSize);
+    juce::FloatVectorOperations::subtract(desiredDb.data(), target.data(), measured.data(), gridSize);
+
+    float mean = 0.0f;
+    for (auto value : desiredDb)
+        mean += value;
+    juce::FloatVectorOperations::add(desiredDb.data(), -mean / gridSize, gridSize);
+
+    // The calling thread is one of the workers
+    const int numWorkers = options.numThreads > 0 ? options.numThreads : juce::SystemStats::getNumCpus();
+    if (numWorkers > 1)
+        pool = std::make_unique<juce::ThreadPool>(numWorkers - 1);
+
+    scratch.resize((size_t) juce::jmax(1, numWorkers));
+    for (auto& s : scratch)
+    {
+        s.numerator.resize(gridSize);
+        s.denominator.resize(gridSize);
+        s.term.resize(gridSize);
+    }
+}
+
+float AutoEQFitter::evaluate(const std::vector<Band>& bands, Scratch& s, float* responseDb) const
+{
+    juce::FloatVectorOperations::fill(s.numerator.data(), 1.0f, gridSize);
+    juce::FloatVectorOperations::fill(s.denominator.data(), 1.0f, gridSize);
+
+    for (const auto& band : bands)
+    {
+        IIRFilterProcessor::BiquadCoefficients c;
+        IIRFilterProcessor::designFilter(&c, band.type, band.frequency, band.gain, band.q, static_cast<float>(sampleRate));
+
+        // |H(w)|^2 = (B0 + B1 phi + B2 phi^2) / (A0 + A1 phi + A2 phi^2) with phi = sin^2(w/2).
+        // The cos(w) form cancels to nothing in float at low frequencies; these sums are taken in double
+        // from the float coefficients the EQ runs with, and the terms left are all of similar size.
+        const double b0 = c.b0, b1 = c.b1, b2 = c.b2, a1 = c.a1, a2 = c.a2;
+        const auto B0 = static_cast<float>((b0 + b1 + b2) * (b0 + b1 + b2));
+        const auto B1 = static_cast<float>(-4.0 * (b0 * b1 + 4.0 * b0 * b2 + b1 * b2));
+        const auto B2 = static_cast<float>(16.0 * b0 * b2);
+        const auto A0 = static_cast<float>((1.0 + a1 + a2) * (1.0 + a1 + a2));
+        const auto A1 = static_cast<float>(-4.0 * (a1 + 4.0 * a2 + a1 * a2));
+        const auto A2 = static_cast<float>(16.0 * a2);
+
+        juce::FloatVectorOperations::copyWithMultiply(s.term.data(), phi.data(), B1, gridSize);
+        juce::FloatVectorOperations::addWithMultiply(s.term.data(), phiSquared.data(), B2, gridSize);
+        juce::FloatVectorOperations::add(s.term.data(), B0, gridSize);
+        juce::FloatVectorOperations::multiply(s.numerator.data(), s.term.data(), gridSize);
+
+        juce::FloatVectorOperations::copyWithMultiply(s.term.data(), phi.data(), A1, gridSize);
+        juce::FloatVectorOperations::addWithMultiply(s.term.data(), phiSquared.data(), A2, gridSize);
+        juce::FloatVectorOperations::add(s.term.data(), A0, gridSize);
+        juce::FloatVectorOperations::multiply(s.denominator.data(), s.term.data(), gridSize);
+    }
+
+    // One log per grid point for the whole cascade. The error's mean is a level offset, not a shape error.
+    float sum = 0.0f, sumOfSquares = 0.0f;
+    for (int i = 0; i < gridSize; ++i)
+    {
+        const float ratio = juce::jmax(s.numerator[(size_t) i], 1.0e-30f) / juce::jmax(s.denominator[(size_t) i], 1.0e-30f);
+        const float db = 10.0f * std::log10(ratio);
+        if (responseDb != nullptr)
+            responseDb[i] = db;
+
+        const float error = db - desiredDb[(size_t) i];
+        sum += error;
+        sumOfSquares += error * error;
+    }
+
+    return juce::jmax(0.0f, sumOfSquares - sum * sum / gridSize) / gridSize;
+}
+
+void AutoEQFitter::evaluateAll(std::vector<Candidate>& candidates, bool withResponses)
+{
+    const int numCandidates = static_cast<int>(candidates.size());
+    std::atomic<int> next { 0 };
+
+    auto work = [this, &candidates, &next, numCandidates, withResponses](Scratch& s)
+    {
+        for (int i = next++; i < numCandidates; i = next++)
+        {
+            auto& candidate = candidates[(size_t) i];
+            candidate.cost = evaluate(candidate.bands, s, withResponses ? candidate.responseDb.data() : nullptr);
+        }
+    };
+
+    // Helpers pull candidates from the same counter as the calling thread, which then waits for them
+    const int numHelpers = pool != nullptr ? static_cast<int>(scratch.size()) - 1 : 0;
+    std::atomic<int> helpersRunning { numHelpers };
+    juce::WaitableEvent helpersFinished;
+
+    for (int w = 1; w <= numHelpers; ++w)
+    {
+        pool->addJob([&, w]
+        {
+            work(scratch[(size_t) w]);
+            if (--helpersRunning == 0)
+                helpersFinished.signal();
+        });
+    }
+
+    work(scratch[0]);
+    if (numHelpers > 0)
+        helpersFinished.wait();
+
+    numEvaluations += numCandidates;
+}
+
+float AutoEQFitter::getLowerBound(int param) const
+{
+    switch (param % paramsPerBand)
+    {
+        case 0:  return std::log2(options.minFrequency);
+        case 1:  return -options.maxGain;
+        default: return std::log2(options.minQ);
+    }
+}
+
+float AutoEQFitter::getUpperBound(int param) const
+{
+    switch (param % paramsPerBand)
+    {
+        case 0:  return std::log2(options.maxFrequency);
+        case 1:  return options.maxGain;
+        default: return std::log2(options.maxQ);
+    }
+}
+
+std::vector<float> AutoEQFitter::toParams(const std::vector<Band>& bands) const
+{
+    std::vector<float> params(bands.size() * paramsPerBand);
+    for (size_t b = 0; b < bands.size(); ++b)
+    {
+        params[b * paramsPerBand] = std::log2(bands[b].frequency);
+        params[b * paramsPerBand + 1] = bands[b].gain;
+        params[b * paramsPerBand + 2] = std::log2(bands[b].q);
+    }
+
+    for (size_t p = 0; p < params.size(); ++p)
+        params[p] = juce::jlimit(getLowerBound((int) p), getUpperBound((int) p), params[p]);
+    return params;
+}
+
+std::vector<AutoEQFitter::Band> AutoEQFitter::toBands(const std::vector<float>& params, const std::vector<Band>& types) const
+{
+    std::vector<Band> bands(types);
+    for (size_t b = 0; b < bands.size(); ++b)
+    {
+        bands[b].frequency = std::exp2(params[b * paramsPerBand]);
+        bands[b].gain = params[b * paramsPerBand + 1];
+        bands[b].q = std::exp2(params[b * paramsPerBand + 2]);
+    }
+    return bands;
+}
+
+std::vector<AutoEQFitter::Band> AutoEQFitter::placeBands()
+{
+    std::vector<Band> bands;
+    std::vector<float> response(gridSize), residual(gridSize), residualSum(gridSize + 1);
+    float cost = evaluate(bands, scratch[0], response.data());
+
+    // Candidate centres a third of an octave apart across the fit range
+    std::vector<int> centres;
+    for (float freq = options.minFrequency * 1.26f; freq < options.maxFrequency; freq *= 1.26f)
+    {
+        const auto it = std::lower_bound(gridFrequencies.begin(), gridFrequencies.end(), freq);
+        centres.push_back(static_cast<int>(std::distance(gridFrequencies.begin(), it)));
+    }
+
+    const float peakQs[] = { 0.7f, 1.4f, 2.8f, 5.6f };
+    const float shelfQs[] = { 0.5f, 0.7f, 1.0f };
+    const float gainScales[] = { 0.5f, 1.0f };
+
+    for (int b = 0; b < options.numBands; ++b)
+    {
+        // What the bands so far leave to correct, with running sums for the shelves' mean levels
+        for (int i = 0; i < gridSize; ++i)
+        {
+            residual[(size_t) i] = desiredDb[(size_t) i] - response[(size_t) i];
+            residualSum[(size_t) i + 1] = residualSum[(size_t) i] + residual[(size_t) i];
+        }
+
+        std::vector<Candidate> candidates;
+        auto addCandidate = [&](FilterType type, int centre, float level, float q)
+        {
+            for (auto scale : gainScales)
+            {
+                Candidate candidate;
+                candidate.bands = bands;
+                candidate.bands.push_back({ type, gridFrequencies[(size_t) centre],
+                                            juce::jlimit(-options.maxGain, options.maxGain, level * scale), q });
+                candidates.push_back(std::move(candidate));
+            }
+        };
+
+        for (int centre : centres)
+        {
+            for (auto q : peakQs)
+                addCandidate(FilterType::Peak, centre, residual[(size_t) centre], q);
+
+            const float below = residualSum[(size_t) centre] / static_cast<float>(juce::jmax(1, centre));
+            const float above = (residualSum[gridSize] - residualSum[(size_t) centre]) / static_cast<float>(juce::jmax(1, gridSize - centre));
+            for (auto q : shelfQs)
+            {
+                addCandidate(FilterType::LowShelf, centre, below, q);
+                addCandidate(FilterType::HighShelf, centre, above, q);
+            }
+        }
+
+        evaluateAll(candidates);
+
+        const auto best = std::min_element(candidates.begin(), candidates.end(),
+                                           [](const Candidate& a, const Candidate& c) { return a.cost < c.cost; });
+
+        // Stop once another band no longer helps noticeably
+        if (best == candidates.end() || best->cost > cost * 0.98f)
+            break;
+
+        // Let the bands so far settle around the new one before placing the next
+        bands = polishBands(best->bands, 10);
+        cost = evaluate(bands, scratch[0], response.data());
+    }
+
+    // Bands not placed join the refinement as flat peaks
+    while (static_cast<int>(bands.size()) < options.numBands)
+        bands.push_back({ FilterType::Peak, std::sqrt(options.minFrequency * options.maxFrequency), 0.0f, 1.0f });
+
+    return bands;
+}
+
+std::vector<AutoEQFitter::Band> AutoEQFitter::refineBands(const std::vector<Band>& initial)
+{
+    // Differential evolution (rand-to-best/1/bin), with the types as placed.
+    // Trials are drawn on this thread from a fixed seed, so the result does not depend on the number of workers.
+    const int numParams = static_cast<int>(initial.size()) * paramsPerBand;
+    const int populationSize = juce::jmax(20, 2 * numParams);
+    const float spread[paramsPerBand] = { 0.5f, 3.0f, 1.0f }; // Initial scatter around the placed bands
+
+    auto clampParam = [this](int p, float value) { return juce::jlimit(getLowerBound(p), getUpperBound(p), value); };
+
+    const auto start = toParams(initial);
+    juce::Random random(0x5eed);
+    std::vector<std::vector<float>> population((size_t) populationSize, start);
+    for (int m = 1; m < populationSize; ++m)
+        for (int p = 0; p < numParams; ++p)
+            population[(size_t) m][(size_t) p] = clampParam(p, start[(size_t) p] + spread[p % paramsPerBand] * (2.0f * random.nextFloat() - 1.0f));
+
+    std::vector<Candidate> members((size_t) populationSize);
+    for (int m = 0; m < populationSize; ++m)
+        members[(size_t) m].bands = toBands(population[(size_t) m], initial);
+    evaluateAll(members);
+
+    auto findBest = [&]
+    {
+        return static_cast<int>(std::distance(members.begin(), std::min_element(members.begin(), members.end(),
+                                              [](const Candidate& a, const Candidate& c) { return a.cost < c.cost; })));
+    };
+
+    int best = findBest();
+    float bestCost = members[(size_t) best].cost;
+    int generationsWithoutProgress = 0;
+
+    std::vector<std::vector<float>> trialParams((size_t) populationSize, start);
+    std::vector<Candidate> trials((size_t) populationSize);
+
+    for (int generation = 0; generation < options.maxGenerations && generationsWithoutProgress < 40; ++generation)
+    {
+        const float F = 0.4f + 0.4f * random.nextFloat(); // Dithered per generation
+        const float crossover = 0.9f;
+
+        for (int m = 0; m < populationSize; ++m)
+        {
+            int r1, r2;
+            do { r1 = random.nextInt(populationSize); } while (r1 == m);
+            do { r2 = random.nextInt(populationSize); } while (r2 == m || r2 == r1);
+            const int forced = random.nextInt(numParams);
+
+            const auto& x = population[(size_t) m];
+            auto& trial = trialParams[(size_t) m];
+            for (int p = 0; p < numParams; ++p)
+            {
+                const auto i = (size_t) p;
+                if (p == forced || random.nextFloat() < crossover)
+                    trial[i] = clampParam(p, x[i] + F * (population[(size_t) best][i] - x[i])
+                                                  + F * (population[(size_t) r1][i] - population[(size_t) r2][i]));
+                else
+                    trial[i] = x[i];
+            }
+            trials[(size_t) m].bands = toBands(trial, initial);
+        }
+
+        evaluateAll(trials);
+
+        for (int m = 0; m < populationSize; ++m)
+        {
+            if (trials[(size_t) m].cost <= members[(size_t) m].cost)
+            {
+                std::swap(population[(size_t) m], trialParams[(size_t) m]);
+                std::swap(members[(size_t) m], trials[(size_t) m]);
+            }
+        }
+
+        best = findBest();
+        if (members[(size_t) best].cost < bestCost * 0.999f)
+            generationsWithoutProgress = 0;
+        else
+            ++generationsWithoutProgress;
+        bestCost = juce::jmin(bestCost, members[(size_t) best].cost);
+    }
+
+    return members[(size_t) best].bands;
+}
+
+std::vector<AutoEQFitter::Band> AutoEQFitter::polishBands(const std::vector<Band>& initial, int maxIterations)
+{
+    // Levenberg-Marquardt on the dB residuals. The Jacobian comes from forward differences,
+    // one candidate per parameter, evaluated in parallel.
+    const int numParams = static_cast<int>(initial.size()) * paramsPerBand;
+    auto params = toParams(initial);
+
+    std::vector<float> response(gridSize), trialResponse(gridSize);
+    float cost = evaluate(toBands(params, initial), scratch[0], response.data());
+
+    std::vector<Candidate> probes((size_t) numParams);
+    std::vector<float> steps((size_t) numParams), residual(gridSize);
+    std::vector<std::vector<float>> jacobian((size_t) numParams, std::vector<float>(gridSize));
+    std::vector<double> normal((size_t) (numParams * numParams)), gradient((size_t) numParams), system, delta;
+    double damping = 1.0e-2;
+
+    for (int iteration = 0; iteration < maxIterations; ++iteration)
+    {
+        for (int p = 0; p < numParams; ++p)
+        {
+            // Step away from the nearer bound, so the probe stays inside the range
+            const float size = p % paramsPerBand == 1 ? 0.01f : 0.002f;
+            const auto i = (size_t) p;
+            steps[i] = params[i] + size <= getUpperBound(p) ? size : -size;
+
+            auto probe = params;
+            probe[i] += steps[i];
+            probes[i].bands = toBands(probe, initial);
+            probes[i].responseDb.resize(gridSize);
+        }
+        evaluateAll(probes, true);
+
+        // Residuals and Jacobian columns with their means removed, as the cost ignores the level
+        auto removeMean = [](std::vector<float>& v)
+        {
+            float mean = 0.0f;
+            for (auto value : v)
+                mean += value;
+            juce::FloatVectorOperations::add(v.data(), -mean / static_cast<float>(v.size()), (int) v.size());
+        };
+
+        juce::FloatVectorOperations::subtract(residual.data(), response.data(), desiredDb.data(), gridSize);
+        removeMean(residual);
+
+        for (int p = 0; p < numParams; ++p)
+        {
+            auto& column = jacobian[(size_t) p];
+            juce::FloatVectorOperations::subtract(column.data(), probes[(size_t) p].responseDb.data(), response.data(), gridSize);
+            juce::FloatVectorOperations::multiply(column.data(), 1.0f / steps[(size_t) p], gridSize);
+            removeMean(column);
+        }
+
+        // Normal equations J^T J and J^T r
+        for (int p = 0; p < numParams; ++p)
+        {
+            const auto& column = jacobian[(size_t) p];
+            double g = 0.0;
+            for (int k = 0; k < gridSize; ++k)
+                g += column[(size_t) k] * residual[(size_t) k];
+            gradient[(size_t) p] = g;
+
+            for (int q = 0; q <= p; ++q)
+            {
+                const auto& other = jacobian[(size_t) q];
+                double sum = 0.0;
+                for (int k = 0; k < gridSize; ++k)
+                    sum += column[(size_t) k] * other[(size_t) k];
+                normal[(size_t) (p * numParams + q)] = normal[(size_t) (q * numParams + p)] = sum;
+            }
+        }
+
+        // Raise the damping until a step lowers the cost
+        bool improved = false;
+        for (int attempt = 0; attempt < 8 && !improved; ++attempt)
+        {
+            system = normal;
+            for (int p = 0; p < numParams; ++p)
+                system[(size_t) (p * numParams + p)] += damping * normal[(size_t) (p * numParams + p)] + 1.0e-9;
+
+            delta.assign(gradient.begin(), gradient.end());
+            if (!solveLinearSystem(system, delta, numParams))
+            {
+                damping *= 10.0;
+                continue;
+            }
+
+            auto trial = params;
+            for (int p = 0; p < numParams; ++p)
+                trial[(size_t) p] = juce::jlimit(getLowerBound(p), getUpperBound(p), trial[(size_t) p] - static_cast<float>(delta[(size_t) p]));
+
+            const float trialCost = evaluate(toBands(trial, initial), scratch[0], trialResponse.data());
+            ++numEvaluations;
+
+            if (trialCost < cost)
+            {
+                const bool converged = trialCost > cost * 0.9999f;
+                params = trial;
+                cost = trialCost;
+                std::swap(response, trialResponse);
+                damping = juce::jmax(1.0e-7, damping * 0.3);
+                improved = true;
+
+                if (converged)
+                    return toBands(params, initial);
+            }
+            else
+            {
+                damping *= 10.0;
+            }
+        }
+
+        if (!improved)
+            break;
+    }
+
+    return toBands(params, initial);
+}
+
+AutoEQFitter::Result AutoEQFitter::fit()
+{
+    numEvaluations = 0;
+
+    Result result;
+    result.initialError = std::sqrt(evaluate({}, scratch[0]));
+
+    auto bands = polishBands(refineBands(placeBands()), 50);
+    result.finalError = std::sqrt(evaluate(bands, scratch[0]));
+
+    // Bands left close to flat are not needed; the rest in frequency order
+    for (auto& band : bands)
+        if (std::abs(band.gain) < 0.1f)
+            band.type = FilterType::Bypass;
+
+    std::stable_sort(bands.begin(), bands.end(), [](const Band& a, const Band& b)
+    {
+        const bool aUsed = a.type != FilterType::Bypass;
+        const bool bUsed = b.type != FilterType::Bypass;
+        return aUsed != bUsed ? aUsed : a.frequency < b.frequency;
+    });
+
+    result.bands = std::move(bands);
+    result.numEvaluations = numEvaluations;
+    return result;
+}
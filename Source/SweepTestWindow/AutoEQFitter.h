@@ -0,0 +1,96 @@
+// AutoEQFitter.h
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "../EffectJUCE/IIRFilterProcessor.h"
+
+// Fits parametric EQ bands so that a measured magnitude response follows a target curve.
+// Both curves are smoothed to 1/6 octave and resampled onto a log-spaced frequency grid, where the
+// cascade's magnitude is evaluated with vector operations from a precomputed sin^2(w/2).
+// Bands are placed one at a time from a candidate search, refined together by differential evolution
+// and polished by Levenberg-Marquardt. The cost evaluations of each round run in parallel on a thread pool.
+class AutoEQFitter
+{
+public:
+    struct Band
+    {
+        IIRFilterProcessor::FilterType type = IIRFilterProcessor::FilterType::Bypass;
+        float frequency = 1000.0f;
+        float gain = 0.0f;
+        float q = 0.7f;
+    };
+
+    struct Options
+    {
+        int numBands = 7;
+        float minFrequency = 30.0f;     // Fit range; band centres stay inside it
+        float maxFrequency = 16000.0f;
+        float maxGain = 12.0f;          // dB either way, as the EQ window allows
+        float minQ = 0.25f;
+        float maxQ = 10.0f;
+        int maxGenerations = 300;
+        int numThreads = 0;             // 0 = one per CPU
+    };
+
+    struct Result
+    {
+        std::vector<Band> bands;        // By frequency; Bypass bands were not needed
+        float initialError = 0.0f;      // RMS dB over the grid, before and after the EQ
+        float finalError = 0.0f;
+        int numEvaluations = 0;
+    };
+
+    // Curves in dB at ascending frequencies in Hz, as SweepTestAnalyzer produces them.
+    // An empty target is flat. The overall level difference is left alone; only the shape is corrected.
+    AutoEQFitter(const std::vector<float>& frequencies, const std::vector<float>& measuredDb,
+                 const std::vector<float>& targetFrequencies, const std::vector<float>& targetDb,
+                 double sampleRate, const Options& options);
+
+    // Blocks until done; run it off the message thread
+    Result fit();
+
+private:
+    static constexpr int gridSize = 256;
+    static constexpr int paramsPerBand = 3; // log2 frequency, gain, log2 Q
+
+    struct Scratch
+    {
+        std::vector<float> numerator, denominator, term;
+    };
+
+    struct Candidate
+    {
+        std::vector<Band> bands;
+        float cost = 0.0f;
+        std::vector<float> responseDb;  // Sized by the caller when the response is wanted
+    };
+
+    double sampleRate;
+    Options options;
+
+    std::vector<float> gridFrequencies;
+    std::vector<float> phi;             // sin^2(w/2) per grid point
+    std::vector<float> phiSquared;
+    std::vector<float> desiredDb;       // Target minus measured, mean removed
+
+    std::unique_ptr<juce::ThreadPool> pool;
+    std::vector<Scratch> scratch;       // One per worker, the calling thread included
+    int numEvaluations = 0;
+
+    // Mean squared dB error of the cascade against desiredDb; responseDb gets the response if given
+    float evaluate(const std::vector<Band>& bands, Scratch& s, float* responseDb = nullptr) const;
+    void evaluateAll(std::vector<Candidate>& candidates, bool withResponses = false);
+
+    // Parameters: log2 frequency, gain and log2 Q per band, kept within the options' ranges
+    float getLowerBound(int param) const;
+    float getUpperBound(int param) const;
+    std::vector<float> toParams(const std::vector<Band>& bands) const;
+    std::vector<Band> toBands(const std::vector<float>& params, const std::vector<Band>& types) const;
+
+    std::vector<Band> placeBands();                                             // Greedy, from a candidate search
+    std::vector<Band> refineBands(const std::vector<Band>& initial);            // Differential evolution
+    std::vector<Band> polishBands(const std::vector<Band>& initial, int maxIterations); // Levenberg-Marquardt
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoEQFitter)
+};
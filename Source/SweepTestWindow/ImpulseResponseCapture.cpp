@@ -0,0 +1,123 @@
+// ImpulseResponseCapture.cpp
+#include "ImpulseResponseCapture.h"
+#include "SweepTestGenerator.h"
+#include <cmath>
+#include <vector>
+
+ImpulseResponseCapture::ImpulseResponseCapture(double sr, float sweepSeconds, float tailSeconds)
+    : sampleRate(sr),
+      sweepLength(static_cast<int>(sweepSeconds * sr)),
+      tailLength(static_cast<int>(tailSeconds * sr))
+{
+}
+
+void ImpulseResponseCapture::render(const ProcessFunction& process, const ResetFunction& reset, int maximumBlockSize)
+{
+    const int totalLength = sweepLength + tailLength;
+
+    // Same generator as the sweep test, but close to the full band: whatever the sweep
+    // leaves out is band limited, and its pre-ringing is lost from the causal response
+    SweepTestGenerator generator;
+    generator.prepare(sampleRate);
+    generator.setFrequencyRange(10.0f, static_cast<float>(sampleRate * 0.49));
+    generator.setDuration(static_cast<float>(sweepLength / sampleRate));
+    generator.setAmplitude(-15.0f);
+    generator.startSweep();
+
+    excitation.setSize(1, totalLength);
+    excitation.clear();
+    for (int i = 0; i < sweepLength; ++i)
+        excitation.setSample(0, i, generator.getNextSample());
+    generator.stopSweep();
+
+    // One input at a time, so effects that feed one channel into the other are measured path by path
+    const int blockSize = juce::jmax(1, maximumBlockSize);
+    for (int input = 0; input < 2; ++input)
+    {
+        auto& recording = recordings[input];
+        recording.setSize(2, totalLength);
+        recording.clear();
+        recording.copyFrom(input, 0, excitation, 0, 0, totalLength);
+
+        reset();
+        juce::dsp::AudioBlock<float> block(recording);
+        for (int start = 0; start < totalLength; start += blockSize)
+            process(block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(juce::jmin(blockSize, totalLength - start))));
+    }
+}
+
+juce::AudioBuffer<float> ImpulseResponseCapture::extractImpulseResponse() const
+{
+    const int totalLength = excitation.getNumSamples();
+    if (totalLength == 0 || recordings[1].getNumSamples() != totalLength)
+        return {};
+
+    // Negative lags wrap to the end of the FFT frame, beyond the tail that is kept
+    const int fftOrder = juce::jlimit(1, 30, static_cast<int>(std::ceil(std::log2(static_cast<double>(totalLength)))));
+    const int fftSize = 1 << fftOrder;
+    juce::dsp::FFT fft(fftOrder);
+
+    std::vector<float> sweepSpectrum(static_cast<size_t>(fftSize) * 2, 0.0f);
+    std::copy(excitation.getReadPointer(0), excitation.getReadPointer(0) + totalLength, sweepSpectrum.begin());
+    fft.performRealOnlyForwardTransform(sweepSpectrum.data(), true);
+
+    // Regularise where the sweep has no energy (below 20 Hz, above the end frequency)
+    const int numBins = fftSize / 2 + 1;
+    float maxPower = 0.0f;
+    for (int bin = 0; bin < numBins; ++bin)
+    {
+        const float re = sweepSpectrum[static_cast<size_t>(2 * bin)];
+        const float im = sweepSpectrum[static_cast<size_t>(2 * bin + 1)];
+        maxPower = juce::jmax(maxPower, re * re + im * im);
+    }
+    const float regularisation = maxPower * 1.0e-5f;
+
+    constexpr int numPaths = 4;
+    juce::AudioBuffer<float> impulseResponse(numPaths, tailLength);
+    std::vector<float> spectrum(static_cast<size_t>(fftSize) * 2);
+    int length = 1;
+
+    for (int path = 0; path < numPaths; ++path)
+    {
+        const auto* recorded = recordings[path / 2].getReadPointer(path % 2);
+        std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+        std::copy(recorded, recorded + totalLength, spectrum.begin());
+        fft.performRealOnlyForwardTransform(spectrum.data(), true);
+
+        // H = Y X* / (|X|^2 + e)
+        for (int bin = 0; bin < numBins; ++bin)
+        {
+            const float xr = sweepSpectrum[static_cast<size_t>(2 * bin)];
+            const float xi = sweepSpectrum[static_cast<size_t>(2 * bin + 1)];
+            const float yr = spectrum[static_cast<size_t>(2 * bin)];
+            const float yi = spectrum[static_cast<size_t>(2 * bin + 1)];
+            const float scale = 1.0f / (xr * xr + xi * xi + regularisation);
+
+            spectrum[static_cast<size_t>(2 * bin)] = (yr * xr + yi * xi) * scale;
+            spectrum[static_cast<size_t>(2 * bin + 1)] = (yi * xr - yr * xi) * scale;
+        }
+
+        fft.performRealOnlyInverseTransform(spectrum.data());
+        impulseResponse.copyFrom(path, 0, spectrum.data(), tailLength);
+    }
+
+    // Drop the silent end; distortion products land at negative time and are never copied
+    const float peak = impulseResponse.getMagnitude(0, tailLength);
+    const float threshold = peak * 1.0e-5f;
+
+    for (int path = 0; path < numPaths; ++path)
+    {
+        const auto* data = impulseResponse.getReadPointer(path);
+        for (int i = tailLength - 1; i >= length; --i)
+        {
+            if (std::abs(data[i]) > threshold)
+            {
+                length = i + 1;
+                break;
+            }
+        }
+    }
+
+    impulseResponse.setSize(numPaths, length, true);
+    return impulseResponse;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+
+// Offline impulse response measurement of a linear effect.
+// Renders the exponential sweep of SweepTestGenerator through a stereo process callback, once into
+// each input channel, then recovers the four responses by regularised spectral division.
+class ImpulseResponseCapture
+{
+public:
+    using ProcessFunction = std::function<void(const juce::dsp::AudioBlock<float>&)>;
+    using ResetFunction = std::function<void()>;
+
+    ImpulseResponseCapture(double sampleRate, float sweepSeconds = 2.0f, float tailSeconds = 6.0f);
+
+    // Feeds the sweep to the left channel, then to the right, and records both outputs of each pass,
+    // in blocks of at most maximumBlockSize; reset runs before each pass.
+    // The caller must own the processor exclusively for the duration of the render.
+    void render(const ProcessFunction& process, const ResetFunction& reset, int maximumBlockSize);
+
+    // Deconvolves the recordings into a true-stereo impulse response of at most tailSeconds: channel
+    // 2 * input + output holds the path from that input to that output (left = 0, right = 1).
+    // Trimmed after all four decay below -100 dB of the largest peak; delay ahead of them is kept.
+    // Band limited to the sweep range (10 Hz to 0.49 fs).
+    juce::AudioBuffer<float> extractImpulseResponse() const;
+
+    double getSampleRate() const { return sampleRate; }
+
+private:
+    double sampleRate;
+    int sweepLength;
+    int tailLength;
+
+    juce::AudioBuffer<float> excitation;    // Mono sweep, zero padded to the recording length
+    juce::AudioBuffer<float> recordings[2]; // Stereo effect output, for the sweep on the left and on the right
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ImpulseResponseCapture)
+};
@@ -165,12 +165,12 @@ void FrequencySpectrumDisplay::drawMagnitudeLabels(juce::Graphics& g, const juce
 juce::Array<SweepTestAnalyzer*> SweepTestAnalyzer::openAnalyzers;
 juce::CriticalSection SweepTestAnalyzer::analyzerLock;
 
-SweepTestAnalyzer::SweepTestAnalyzer(const juce::File& audioFile)
+SweepTestAnalyzer::SweepTestAnalyzer(const juce::File& audioFile, AutoEQCallback onAutoEQ, EQResponse measuredEQ)
     : DocumentWindow("Sweep Test Analysis - " + audioFile.getFileName(),
                      juce::Colours::darkgrey,
                      DocumentWindow::allButtons)
 {
-    content = std::make_unique<AnalyzerContent>(audioFile);
+    content = std::make_unique<AnalyzerContent>(audioFile, std::move(onAutoEQ), measuredEQ);
     setContentOwned(content.get(), true);
 
     setResizable(true, true);
@@ -195,9 +195,9 @@ void SweepTestAnalyzer::closeButtonPressed()
     juce::MessageManager::callAsync([this]() { delete this; });
 }
 
-void SweepTestAnalyzer::showAnalyzer(const juce::File& audioFile)
+void SweepTestAnalyzer::showAnalyzer(const juce::File& audioFile, AutoEQCallback onAutoEQ, EQResponse measuredEQ)
 {
-    (new SweepTestAnalyzer(audioFile))->toFront(true);
+    (new SweepTestAnalyzer(audioFile, std::move(onAutoEQ), std::move(measuredEQ)))->toFront(true);
 }
 
 void SweepTestAnalyzer::deleteAllAnalyzers()
@@ -214,7 +214,8 @@ void SweepTestAnalyzer::deleteAllAnalyzers()
 // ==============================
 // AnalyzerContent
 // ==============================
-SweepTestAnalyzer::AnalyzerContent::AnalyzerContent(const juce::File& audioFile)
+SweepTestAnalyzer::AnalyzerContent::AnalyzerContent(const juce::File& audioFile, AutoEQCallback onAutoEQ, const EQResponse& measuredEQ)
+    : autoEQCallback(std::move(onAutoEQ))
 {
     inputSpectrumDisplay = std::make_unique<FrequencySpectrumDisplay>("Input Signal Spectrum");
     outputSpectrumDisplay = std::make_unique<FrequencySpectrumDisplay>("Output Signal Spectrum");
@@ -234,7 +235,22 @@ SweepTestAnalyzer::AnalyzerContent::AnalyzerContent(const juce::File& audioFile)
     analysisInfoLabel.setJustificationType(juce::Justification::centred);
     addAndMakeVisible(analysisInfoLabel);
 
+    autoEQButton.onClick = [this] { runAutoEQ(); };
+    addAndMakeVisible(autoEQButton);
+
+    for (int count : { 5, 7, 10, 16, 24, IIRFilterProcessor::maxBands })
+        autoEQBandsCombo.addItem(juce::String(count) + " Bands", count);
+    autoEQBandsCombo.setSelectedId(AutoEQFitter::Options().numBands, juce::dontSendNotification);
+    addAndMakeVisible(autoEQBandsCombo);
+
     analyzeAudioFile(audioFile);
+
+    // The fitted bands replace the EQ the sweep went through, so fit to the response without it
+    if (measuredEQ != nullptr)
+        for (size_t i = 0; i < responseDb.size(); ++i)
+            responseDb[i] -= measuredEQ(responseFrequencies[i]);
+
+    autoEQButton.setEnabled(autoEQCallback != nullptr && !responseDb.empty());
 }
 
 SweepTestAnalyzer::AnalyzerContent::~AnalyzerContent() {}
@@ -249,7 +265,10 @@ void SweepTestAnalyzer::AnalyzerContent::resized()
     auto bounds = getLocalBounds().reduced(10);
 
     // Top information area
-    fileInfoLabel.setBounds(bounds.removeFromTop(25));
+    auto infoRow = bounds.removeFromTop(25);
+    autoEQButton.setBounds(infoRow.removeFromRight(100));
+    autoEQBandsCombo.setBounds(infoRow.removeFromRight(100).withTrimmedRight(5));
+    fileInfoLabel.setBounds(infoRow);
     analysisInfoLabel.setBounds(bounds.removeFromTop(25));
     bounds.removeFromTop(10);
 
@@ -364,11 +383,57 @@ void SweepTestAnalyzer::AnalyzerContent::analyzeAudioFile(const juce::File& file
     leftChannelDisplay->setSpectrumData(inMag, inFreq);
     rightChannelDisplay->setSpectrumData(outMag, outFreq);
 
+    // Response of the device under test, when the output was analysed at the input's frequencies
+    responseFrequencies.clear();
+    responseDb.clear();
+    if (numChannels > 1 && inFreq == outFreq)
+    {
+        responseFrequencies = inFreq;
+        responseDb.resize(outMag.size());
+        for (size_t i = 0; i < outMag.size(); ++i)
+            responseDb[i] = outMag[i] - inMag[i];
+    }
+    analysisSampleRate = sampleRate;
+
     analysisInfoLabel.setText("Analysis complete. Sample rate: " + juce::String(sampleRate) +
                                   " Hz, Duration: " + juce::String(numSamples / sampleRate, 2) + " sec",
                               juce::dontSendNotification);
 }
 
+void SweepTestAnalyzer::AnalyzerContent::runAutoEQ()
+{
+    if (autoEQCallback == nullptr || responseDb.empty())
+        return;
+
+    autoEQButton.setEnabled(false);
+    analysisInfoLabel.setText("Fitting EQ...", juce::dontSendNotification);
+
+    // The EQ window takes on the fitted band count
+    AutoEQFitter::Options options;
+    options.numBands = autoEQBandsCombo.getSelectedId();
+
+    // The fit takes a moment on the pool; the window may be closed before it finishes
+    juce::Component::SafePointer<AnalyzerContent> safeThis(this);
+    juce::Thread::launch([safeThis, frequencies = responseFrequencies, measured = responseDb, sampleRate = analysisSampleRate, options]
+    {
+        // Flat target, default ranges (those of the EQ window's controls)
+        AutoEQFitter fitter(frequencies, measured, {}, {}, sampleRate, options);
+        auto result = fitter.fit();
+
+        juce::MessageManager::callAsync([safeThis, result = std::move(result)]
+        {
+            if (safeThis == nullptr)
+                return;
+
+            safeThis->autoEQButton.setEnabled(true);
+            safeThis->analysisInfoLabel.setText("Auto EQ: response error " + juce::String(result.initialError, 2) +
+                                                    " dB RMS -> " + juce::String(result.finalError, 2) + " dB RMS",
+                                                juce::dontSendNotification);
+            safeThis->autoEQCallback(result.bands);
+        });
+    });
+}
+
 // Traditional FFT + Welch averaging (retained for compatibility with non-sweep signals)
 // This implementation is the same as the improved version provided earlier: Blackman-Harris window, power averaging, window compensation
 void SweepTestAnalyzer::AnalyzerContent::performFFT(const float* audioData, int numSamples,
@@ -4,6 +4,8 @@
 #include <JuceHeader.h>
 #include <memory>
 #include <vector>
+#include <functional>
+#include "AutoEQFitter.h"
 
 class FrequencySpectrumDisplay : public juce::Component
 {
@@ -39,20 +41,27 @@ private:
 class SweepTestAnalyzer : public juce::DocumentWindow
 {
 public:
-    SweepTestAnalyzer(const juce::File& audioFile);
+    // Receives the bands fitted by the Auto EQ button, on the message thread
+    using AutoEQCallback = std::function<void(const std::vector<AutoEQFitter::Band>&)>;
+
+    // Magnitude in dB at a frequency of the EQ the sweep went through, which the fitted bands replace;
+    // Auto EQ takes it out of the measured response. Called while the analyzer is constructed.
+    using EQResponse = std::function<float(float frequency)>;
+
+    SweepTestAnalyzer(const juce::File& audioFile, AutoEQCallback onAutoEQ = nullptr, EQResponse measuredEQ = nullptr);
     ~SweepTestAnalyzer();
     
     void closeButtonPressed() override;
     
     // Static management functions
-    static void showAnalyzer(const juce::File& audioFile);
+    static void showAnalyzer(const juce::File& audioFile, AutoEQCallback onAutoEQ = nullptr, EQResponse measuredEQ = nullptr);
     static void deleteAllAnalyzers();
     
 private:
     class AnalyzerContent : public juce::Component
     {
     public:
-        AnalyzerContent(const juce::File& audioFile);
+        AnalyzerContent(const juce::File& audioFile, AutoEQCallback onAutoEQ, const EQResponse& measuredEQ);
         ~AnalyzerContent();
         
         void paint(juce::Graphics& g) override;
@@ -68,6 +77,16 @@ private:
         // File information labels
         juce::Label fileInfoLabel;
         juce::Label analysisInfoLabel;
+
+        // Auto EQ: fits the EQ bands to flatten the measured response (output minus input, without the EQ)
+        juce::TextButton autoEQButton { "Auto EQ" };
+        juce::ComboBox autoEQBandsCombo;    // Bands to fit, up to IIRFilterProcessor::maxBands; item id = count
+        AutoEQCallback autoEQCallback;
+        std::vector<float> responseFrequencies;
+        std::vector<float> responseDb;
+        double analysisSampleRate = 48000.0;
+
+        void runAutoEQ();
         
         // FFT parameters
         static constexpr int fftOrder = 12;
@@ -100,8 +100,10 @@ float SweepTestGenerator::getProgress() const
 
 void SweepTestGenerator::setFrequencyRange(float startFreq, float endFreq)
 {
-    startFrequency = juce::jlimit(20.0f, 20000.0f, startFreq);
-    endFrequency = juce::jlimit(startFrequency, 20000.0f, endFreq);
+    // Up to Nyquist of the prepared rate; impulse response capture sweeps the full band
+    const float nyquist = static_cast<float>(sampleRate * 0.5);
+    startFrequency = juce::jlimit(1.0f, nyquist, startFreq);
+    endFrequency = juce::jlimit(startFrequency, nyquist, endFreq);
 }
 
 void SweepTestGenerator::setDuration(float seconds)
@@ -729,6 +729,15 @@ def generate_cmakelists(projects: list[dict]) -> str:
         
         lines.append("")
     
+    # JUCE apps run their juce::UnitTest suites with --run-tests and exit with 1 on any failure
+    if has_juce:
+        lines.append("# Unit tests: ctest runs each app with --run-tests")
+        lines.append("enable_testing()")
+        for proj in projects:
+            if proj.get("is_juce"):
+                lines.append(f"add_test(NAME {proj['name']}_unit_tests COMMAND {proj['name']} --run-tests)")
+        lines.append("")
+
     # Export target names for build script
     lines.append("# Export target names for build script")
     lines.append("file(WRITE ${CMAKE_BINARY_DIR}/targets.txt \"" + "\\n".join(target_names) + "\")")